@@ -563,6 +563,35 @@ extern "C" {
 
 /*! @} */
 
+/*! @defgroup event_fds Event file descriptor flags
+ *  @brief Event file descriptor readiness flags.
+ *
+ *  See [application file descriptors](@ref events_fd) for how these are used.
+ *
+ *  @ingroup window
+ *  @{ */
+
+/*! @brief The file descriptor is or should be watched for readability.
+ *
+ *  If this bit is set the file descriptor has data available for reading, or
+ *  should be watched for this condition.
+ */
+#define GLFW_EVENT_FD_READ       0x0001
+/*! @brief The file descriptor is or should be watched for writability.
+ *
+ *  If this bit is set the file descriptor can be written to without blocking,
+ *  or should be watched for this condition.
+ */
+#define GLFW_EVENT_FD_WRITE      0x0002
+/*! @brief An error or hangup occurred on the file descriptor.
+ *
+ *  If this bit is set an error or hangup occurred on the file descriptor.  This
+ *  condition is always reported and does not need to be requested.
+ */
+#define GLFW_EVENT_FD_ERROR      0x0004
+
+/*! @} */
+
 /*! @defgroup buttons Mouse buttons
  *  @brief Mouse button IDs.
  *
@@ -940,6 +969,18 @@ extern "C" {
  *  Initial position y-coordinate [window hint](@ref GLFW_POSITION_Y).
  */
 #define GLFW_POSITION_Y             0x0002000F
+/*! @brief Buffer swap statistics window hint and attribute
+ *
+ *  Buffer swap statistics [window hint](@ref GLFW_SWAP_STATISTICS_hint) or
+ *  [window attribute](@ref GLFW_SWAP_STATISTICS_attrib).
+ */
+#define GLFW_SWAP_STATISTICS        0x00020010
+/*! @brief Present thread window hint and attribute
+ *
+ *  Present thread [window hint](@ref GLFW_PRESENT_THREAD_hint) or
+ *  [window attribute](@ref GLFW_PRESENT_THREAD_attrib).
+ */
+#define GLFW_PRESENT_THREAD         0x00020011
 
 /*! @brief Framebuffer bit depth hint.
  *
@@ -1308,6 +1349,11 @@ extern "C" {
  *  Platform selection [init hint](@ref GLFW_PLATFORM).
  */
 #define GLFW_PLATFORM               0x00050003
+/*! @brief Lazy context release init hint.
+ *
+ *  Lazy context release [init hint](@ref GLFW_LAZY_CONTEXT_RELEASE_hint).
+ */
+#define GLFW_LAZY_CONTEXT_RELEASE   0x00050004
 /*! @brief macOS specific init hint.
  *
  *  macOS specific [init hint](@ref GLFW_COCOA_CHDIR_RESOURCES_hint).
@@ -1323,11 +1369,21 @@ extern "C" {
  *  X11 specific [init hint](@ref GLFW_X11_XCB_VULKAN_SURFACE_hint).
  */
 #define GLFW_X11_XCB_VULKAN_SURFACE 0x00052001
+/*! @brief X11 specific init hint.
+ *
+ *  X11 specific [init hint](@ref GLFW_X11_CURSOR_POS_CACHE_hint).
+ */
+#define GLFW_X11_CURSOR_POS_CACHE   0x00052002
 /*! @brief Wayland specific init hint.
  *
  *  Wayland specific [init hint](@ref GLFW_WAYLAND_LIBDECOR_hint).
  */
 #define GLFW_WAYLAND_LIBDECOR       0x00053001
+/*! @brief Wayland specific init hint.
+ *
+ *  Wayland specific [init hint](@ref GLFW_WAYLAND_EVENT_THREAD_hint).
+ */
+#define GLFW_WAYLAND_EVENT_THREAD   0x00053002
 /*! @} */
 
 /*! @addtogroup init
@@ -1342,6 +1398,60 @@ extern "C" {
 #define GLFW_PLATFORM_WAYLAND       0x00060003
 #define GLFW_PLATFORM_X11           0x00060004
 #define GLFW_PLATFORM_NULL          0x00060005
+
+/*! @brief Number of window system events processed.
+ *
+ *  Number of window system events processed by event processing
+ *  ([counter](@ref counters)).
+ */
+#define GLFW_COUNTER_EVENTS         0x00070001
+/*! @brief Number of event reads from the window system connection.
+ *
+ *  Number of times event processing or an event wait read new events from the
+ *  window system connection.  Checks that found no new events are not counted
+ *  ([counter](@ref counters)).
+ */
+#define GLFW_COUNTER_EVENT_READS    0x00070002
+/*! @brief Number of flushes of the window system connection.
+ *
+ *  Number of times event processing or an event wait flushed requests to the
+ *  window system ([counter](@ref counters)).
+ */
+#define GLFW_COUNTER_FLUSHES        0x00070003
+/*! @brief Number of synchronous round trips to the window system.
+ *
+ *  Number of requests that waited for a reply from the window system
+ *  ([counter](@ref counters)).
+ */
+#define GLFW_COUNTER_ROUND_TRIPS    0x00070004
+/*! @brief Number of context changes made in the context creation API.
+ *
+ *  Number of times a context was made current or released in the context
+ *  creation API ([counter](@ref counters)).
+ */
+#define GLFW_COUNTER_MAKE_CURRENT   0x00070005
+/*! @brief Number of frames not captured.
+ *
+ *  Number of frames that [frame capture](@ref frame_capture) dropped because
+ *  the queue was full, the context was not current, the framebuffer was empty
+ *  or a frame could not be allocated ([counter](@ref counters)).
+ */
+#define GLFW_COUNTER_DROPPED_FRAMES 0x00070006
+/*! @} */
+
+/*! @addtogroup window
+ *  @{ */
+/*! @brief Raw RGBA frame capture format.
+ *
+ *  Frames are written as rows of 8-bit RGBA pixels, top row first, with no
+ *  header ([frame capture](@ref frame_capture)).
+ */
+#define GLFW_CAPTURE_RAW            0x00080001
+/*! @brief PNG frame capture format.
+ *
+ *  Frames are written as PNG images ([frame capture](@ref frame_capture)).
+ */
+#define GLFW_CAPTURE_PNG            0x00080002
 /*! @} */
 
 #define GLFW_DONT_CARE              -1
@@ -1415,6 +1525,18 @@ typedef struct GLFWwindow GLFWwindow;
  */
 typedef struct GLFWcursor GLFWcursor;
 
+/*! @brief Opaque timer object.
+ *
+ *  Opaque event loop timer object.
+ *
+ *  @see @ref events_timer
+ *
+ *  @since Added in version 3.5.
+ *
+ *  @ingroup window
+ */
+typedef struct GLFWtimer GLFWtimer;
+
 /*! @brief The function pointer type for memory allocation callbacks.
  *
  *  This is the function pointer type for memory allocation callbacks.  A memory
@@ -1780,6 +1902,29 @@ typedef void (* GLFWframebuffersizefun)(GLFWwindow* window, int width, int heigh
  */
 typedef void (* GLFWwindowcontentscalefun)(GLFWwindow* window, float xscale, float yscale);
 
+/*! @brief The function pointer type for swap complete callbacks.
+ *
+ *  This is the function pointer type for swap complete callbacks.  A swap
+ *  complete callback function has the following signature:
+ *  @code
+ *  void function_name(GLFWwindow* window, double time, uint64_t sequence)
+ *  @endcode
+ *
+ *  @param[in] window The window whose swapped buffer was presented.
+ *  @param[in] time The time, in seconds and in the same time base as @ref
+ *  glfwGetTime, at which the buffer was presented.
+ *  @param[in] sequence The value of the refresh counter of the monitor when
+ *  the buffer was presented, or zero if not known.
+ *
+ *  @sa @ref swap_complete
+ *  @sa @ref glfwSetSwapCompleteCallback
+ *
+ *  @since Added in version 3.5.
+ *
+ *  @ingroup window
+ */
+typedef void (* GLFWswapcompletefun)(GLFWwindow* window, double time, uint64_t sequence);
+
 /*! @brief The function pointer type for mouse button callbacks.
  *
  *  This is the function pointer type for mouse button callback functions.
@@ -2011,6 +2156,48 @@ typedef void (* GLFWmonitorfun)(GLFWmonitor* monitor, int event);
  */
 typedef void (* GLFWjoystickfun)(int jid, int event);
 
+/*! @brief The function pointer type for event file descriptor callbacks.
+ *
+ *  This is the function pointer type for event file descriptor callbacks.  An
+ *  event file descriptor callback function has the following signature:
+ *  @code
+ *  void function_name(int fd, int events, void* user)
+ *  @endcode
+ *
+ *  @param[in] fd The file descriptor that became ready.
+ *  @param[in] events A bit field of the [readiness flags](@ref event_fds) that
+ *  are set for the file descriptor.
+ *  @param[in] user The user-defined pointer passed to @ref glfwAddEventFd.
+ *
+ *  @sa @ref events_fd
+ *  @sa @ref glfwAddEventFd
+ *
+ *  @since Added in version 3.5.
+ *
+ *  @ingroup window
+ */
+typedef void (* GLFWeventfdfun)(int fd, int events, void* user);
+
+/*! @brief The function pointer type for timer callbacks.
+ *
+ *  This is the function pointer type for event loop timer callbacks.  A timer
+ *  callback function has the following signature:
+ *  @code
+ *  void function_name(GLFWtimer* timer, void* user)
+ *  @endcode
+ *
+ *  @param[in] timer The timer that expired.
+ *  @param[in] user The user-defined pointer passed to @ref glfwCreateTimer.
+ *
+ *  @sa @ref events_timer
+ *  @sa @ref glfwCreateTimer
+ *
+ *  @since Added in version 3.5.
+ *
+ *  @ingroup window
+ */
+typedef void (* GLFWtimerfun)(GLFWtimer* timer, void* user);
+
 /*! @brief Video mode type.
  *
  *  This describes a single video mode.
@@ -2155,6 +2342,56 @@ typedef struct GLFWallocator
     void* user;
 } GLFWallocator;
 
+/*! @brief The number of buckets in each buffer swap histogram.
+ *
+ *  The number of buckets in each histogram of @ref GLFWswapstats.
+ *
+ *  @ingroup window
+ */
+#define GLFW_SWAP_HISTOGRAM_SIZE 20
+
+/*! @brief Buffer swap statistics.
+ *
+ *  This describes the timing of the buffer swaps of a window since its
+ *  statistics were last reset.
+ *
+ *  Bucket `i` of each histogram counts the times of at least 2<sup>i</sup> and
+ *  less than 2<sup>i+1</sup> microseconds, except that the first bucket also
+ *  counts shorter times and the last bucket also counts longer times.
+ *
+ *  @sa @ref swap_statistics
+ *  @sa @ref glfwGetSwapStatistics
+ *
+ *  @since Added in version 3.5.
+ *
+ *  @ingroup window
+ */
+typedef struct GLFWswapstats
+{
+    /*! The number of buffer swaps.
+     */
+    uint64_t swaps;
+    /*! The number of intervals between buffer swaps that were longer than one
+     *  and a half refresh periods of the monitor.
+     */
+    uint64_t missedDeadlines;
+    /*! The total time, in seconds, spent swapping buffers.
+     */
+    double swapTime;
+    /*! The longest time, in seconds, spent in a single buffer swap.
+     */
+    double maxSwapTime;
+    /*! The longest interval, in seconds, between two buffer swaps.
+     */
+    double maxInterval;
+    /*! The histogram of the times spent in each buffer swap.
+     */
+    uint64_t swapTimes[GLFW_SWAP_HISTOGRAM_SIZE];
+    /*! The histogram of the intervals between buffer swaps.
+     */
+    uint64_t intervals[GLFW_SWAP_HISTOGRAM_SIZE];
+} GLFWswapstats;
+
 
 /*************************************************************************
  * GLFW API functions
@@ -2503,6 +2740,55 @@ GLFWAPI int glfwGetError(const char** description);
  */
 GLFWAPI GLFWerrorfun glfwSetErrorCallback(GLFWerrorfun callback);
 
+/*! @brief Returns the value of a performance counter.
+ *
+ *  This function returns the current value of the specified performance
+ *  counter.  Counters let you verify the cost of GLFW operations, for example
+ *  the number of system calls made by event processing, without an external
+ *  profiler.  All counters start at zero when the library is initialized.
+ *
+ *  @param[in] counter The [counter](@ref counters) to query.
+ *  @return The value of the counter, or zero if an [error](@ref error_handling)
+ *  occurred.
+ *
+ *  @errors Possible errors include @ref GLFW_NOT_INITIALIZED and @ref
+ *  GLFW_INVALID_ENUM.
+ *
+ *  @remark Counters not maintained by the current platform remain zero.  The
+ *  @ref GLFW_COUNTER_EVENTS, @ref GLFW_COUNTER_EVENT_READS, @ref
+ *  GLFW_COUNTER_FLUSHES and @ref GLFW_COUNTER_ROUND_TRIPS counters are
+ *  maintained on X11.  The @ref GLFW_COUNTER_MAKE_CURRENT and @ref
+ *  GLFW_COUNTER_DROPPED_FRAMES counters are maintained on all platforms.
+ *
+ *  @thread_safety This function must only be called from the main thread.
+ *
+ *  @sa @ref counters
+ *  @sa @ref glfwResetCounters
+ *
+ *  @since Added in version 3.5.
+ *
+ *  @ingroup init
+ */
+GLFWAPI uint64_t glfwGetCounter(int counter);
+
+/*! @brief Resets all performance counters to zero.
+ *
+ *  This function resets all performance counters to zero, for example at the
+ *  start of each frame or measurement.
+ *
+ *  @errors Possible errors include @ref GLFW_NOT_INITIALIZED.
+ *
+ *  @thread_safety This function must only be called from the main thread.
+ *
+ *  @sa @ref counters
+ *  @sa @ref glfwGetCounter
+ *
+ *  @since Added in version 3.5.
+ *
+ *  @ingroup init
+ */
+GLFWAPI void glfwResetCounters(void);
+
 /*! @brief Returns the currently selected platform.
  *
  *  This function returns the platform that was selected during initialization.  The
@@ -3434,6 +3720,12 @@ GLFWAPI void glfwSetWindowIcon(GLFWwindow* window, int count, const GLFWimage* i
  *  position of its windows.  This function will emit @ref
  *  GLFW_FEATURE_UNAVAILABLE.
  *
+ *  @remark @x11 This function returns the position last reported by the X
+ *  server in an event, without querying the server.  After the position or
+ *  size of the window is set, it returns the requested position until the
+ *  server has reported the result, or for at most half a second after which
+ *  the server is queried.
+ *
  *  @thread_safety This function must only be called from the main thread.
  *
  *  @sa @ref window_pos
@@ -3498,6 +3790,12 @@ GLFWAPI void glfwSetWindowPos(GLFWwindow* window, int xpos, int ypos);
  *  @errors Possible errors include @ref GLFW_NOT_INITIALIZED and @ref
  *  GLFW_PLATFORM_ERROR.
  *
+ *  @remark @x11 This function returns the size last reported by the X server
+ *  in an event, without querying the server.  After the position or size of
+ *  the window is set, it returns the requested size until the server has
+ *  reported the result, or for at most half a second after which the server is
+ *  queried.
+ *
  *  @thread_safety This function must only be called from the main thread.
  *
  *  @sa @ref window_size
@@ -3652,6 +3950,12 @@ GLFWAPI void glfwSetWindowSize(GLFWwindow* window, int width, int height);
  *  @errors Possible errors include @ref GLFW_NOT_INITIALIZED and @ref
  *  GLFW_PLATFORM_ERROR.
  *
+ *  @remark @x11 This function returns the size last reported by the X server
+ *  in an event, without querying the server.  After the position or size of
+ *  the window is set, it returns the requested size until the server has
+ *  reported the result, or for at most half a second after which the server is
+ *  queried.
+ *
  *  @thread_safety This function must only be called from the main thread.
  *
  *  @sa @ref window_fbsize
@@ -3792,6 +4096,52 @@ GLFWAPI float glfwGetWindowOpacity(GLFWwindow* window);
  */
 GLFWAPI void glfwSetWindowOpacity(GLFWwindow* window, float opacity);
 
+/*! @brief Returns the frame pacing margin of the specified window.
+ *
+ *  This function returns the frame pacing margin, in seconds, of the specified
+ *  window.  This is the time before each predicted vertical blank at which
+ *  @ref glfwWaitForNextFrame returns.  The initial margin is zero.
+ *
+ *  @param[in] window The window to query.
+ *  @return The frame pacing margin of the specified window.
+ *
+ *  @errors Possible errors include @ref GLFW_NOT_INITIALIZED.
+ *
+ *  @thread_safety This function must only be called from the main thread.
+ *
+ *  @sa @ref frame_pacing
+ *  @sa @ref glfwSetWindowFrameMargin
+ *
+ *  @since Added in version 3.5.
+ *
+ *  @ingroup window
+ */
+GLFWAPI double glfwGetWindowFrameMargin(GLFWwindow* window);
+
+/*! @brief Sets the frame pacing margin of the specified window.
+ *
+ *  This function sets the frame pacing margin, in seconds, of the specified
+ *  window.  @ref glfwWaitForNextFrame will return this long before each
+ *  predicted vertical blank, leaving the application that much time to render
+ *  and present the frame.  The margin must be between zero and one second.
+ *
+ *  @param[in] window The window to set the margin for.
+ *  @param[in] margin The desired margin, in seconds.
+ *
+ *  @errors Possible errors include @ref GLFW_NOT_INITIALIZED and @ref
+ *  GLFW_INVALID_VALUE.
+ *
+ *  @thread_safety This function must only be called from the main thread.
+ *
+ *  @sa @ref frame_pacing
+ *  @sa @ref glfwGetWindowFrameMargin
+ *
+ *  @since Added in version 3.5.
+ *
+ *  @ingroup window
+ */
+GLFWAPI void glfwSetWindowFrameMargin(GLFWwindow* window, double margin);
+
 /*! @brief Iconifies the specified window.
  *
  *  This function iconifies (minimizes) the specified window if it was
@@ -4118,9 +4468,10 @@ GLFWAPI int glfwGetWindowAttrib(GLFWwindow* window, int attrib);
  *  The supported attributes are [GLFW_DECORATED](@ref GLFW_DECORATED_attrib),
  *  [GLFW_RESIZABLE](@ref GLFW_RESIZABLE_attrib),
  *  [GLFW_FLOATING](@ref GLFW_FLOATING_attrib),
- *  [GLFW_AUTO_ICONIFY](@ref GLFW_AUTO_ICONIFY_attrib) and
- *  [GLFW_FOCUS_ON_SHOW](@ref GLFW_FOCUS_ON_SHOW_attrib).
- *  [GLFW_MOUSE_PASSTHROUGH](@ref GLFW_MOUSE_PASSTHROUGH_attrib)
+ *  [GLFW_AUTO_ICONIFY](@ref GLFW_AUTO_ICONIFY_attrib),
+ *  [GLFW_FOCUS_ON_SHOW](@ref GLFW_FOCUS_ON_SHOW_attrib),
+ *  [GLFW_MOUSE_PASSTHROUGH](@ref GLFW_MOUSE_PASSTHROUGH_attrib) and
+ *  [GLFW_SWAP_STATISTICS](@ref GLFW_SWAP_STATISTICS_attrib).
  *
  *  Some of these attributes are ignored for full screen windows.  The new
  *  value will take effect if the window is later made windowed.
@@ -4153,6 +4504,66 @@ GLFWAPI int glfwGetWindowAttrib(GLFWwindow* window, int attrib);
  */
 GLFWAPI void glfwSetWindowAttrib(GLFWwindow* window, int attrib, int value);
 
+/*! @brief Begins a batch of updates to the specified window.
+ *
+ *  This function begins a batch of updates to the specified window.  Until
+ *  the matching call to @ref glfwEndWindowUpdate, the platform may defer the
+ *  changes made by functions like @ref glfwSetWindowTitle, @ref
+ *  glfwSetWindowSizeLimits, @ref glfwSetWindowAspectRatio and @ref
+ *  glfwSetWindowAttrib, merge changes that replace each other and send them to
+ *  the window system together.
+ *
+ *  Calls to this function may be nested.  Only the outermost call to @ref
+ *  glfwEndWindowUpdate applies the deferred changes.
+ *
+ *  Queries of the window made before the batch has ended, like @ref
+ *  glfwGetWindowSize, may not yet reflect the changes.
+ *
+ *  @param[in] window The window to update.
+ *
+ *  @errors Possible errors include @ref GLFW_NOT_INITIALIZED.
+ *
+ *  @remark @x11 Window title and size hint changes are merged and the
+ *  connection to the X server is flushed only once, when the batch ends.
+ *  Pending size hints are sent before any change to the position, size or
+ *  visibility of the window.
+ *
+ *  @remark @win32 @macos @wayland This function has no effect on the
+ *  platform, as changes are either applied immediately or already batched.
+ *
+ *  @thread_safety This function must only be called from the main thread.
+ *
+ *  @sa @ref window_update
+ *  @sa @ref glfwEndWindowUpdate
+ *
+ *  @since Added in version 3.5.
+ *
+ *  @ingroup window
+ */
+GLFWAPI void glfwBeginWindowUpdate(GLFWwindow* window);
+
+/*! @brief Ends a batch of updates to the specified window.
+ *
+ *  This function ends a batch of updates to the specified window begun with
+ *  @ref glfwBeginWindowUpdate.  If this ends the outermost batch, any changes
+ *  deferred by the platform are sent to the window system.
+ *
+ *  @param[in] window The window to update.
+ *
+ *  @errors Possible errors include @ref GLFW_NOT_INITIALIZED, @ref
+ *  GLFW_INVALID_VALUE and @ref GLFW_PLATFORM_ERROR.
+ *
+ *  @thread_safety This function must only be called from the main thread.
+ *
+ *  @sa @ref window_update
+ *  @sa @ref glfwBeginWindowUpdate
+ *
+ *  @since Added in version 3.5.
+ *
+ *  @ingroup window
+ */
+GLFWAPI void glfwEndWindowUpdate(GLFWwindow* window);
+
 /*! @brief Sets the user pointer of the specified window.
  *
  *  This function sets the user-defined pointer of the specified window.  The
@@ -4496,6 +4907,47 @@ GLFWAPI GLFWframebuffersizefun glfwSetFramebufferSizeCallback(GLFWwindow* window
  */
 GLFWAPI GLFWwindowcontentscalefun glfwSetWindowContentScaleCallback(GLFWwindow* window, GLFWwindowcontentscalefun callback);
 
+/*! @brief Sets the swap complete callback for the specified window.
+ *
+ *  This function sets the swap complete callback of the specified window,
+ *  which is called when a buffer swapped with @ref glfwSwapBuffers or @ref
+ *  glfwSwapBuffersWithDamage has been presented on the screen.  Only buffer
+ *  swaps made while a callback is set are reported, and buffers that were
+ *  never presented are not reported.
+ *
+ *  @param[in] window The window whose callback to set.
+ *  @param[in] callback The new callback, or `NULL` to remove the currently set
+ *  callback.
+ *  @return The previously set callback, or `NULL` if no callback was set or the
+ *  library had not been [initialized](@ref intro_init).
+ *
+ *  @callback_signature
+ *  @code
+ *  void function_name(GLFWwindow* window, double time, uint64_t sequence)
+ *  @endcode
+ *  For more information about the callback parameters, see the
+ *  [function pointer type](@ref GLFWswapcompletefun).
+ *
+ *  @errors Possible errors include @ref GLFW_NOT_INITIALIZED.
+ *
+ *  @remark __Wayland:__ This requires the compositor to support the
+ *  `wp_presentation` protocol and the context to be created with EGL.
+ *
+ *  @remark __X11:__ This requires a GLX context and the
+ *  `GLX_INTEL_swap_event` extension.
+ *
+ *  @remark __Win32, macOS, Null:__ This callback is never called.
+ *
+ *  @thread_safety This function must only be called from the main thread.
+ *
+ *  @sa @ref swap_complete
+ *
+ *  @since Added in version 3.5.
+ *
+ *  @ingroup window
+ */
+GLFWAPI GLFWswapcompletefun glfwSetSwapCompleteCallback(GLFWwindow* window, GLFWswapcompletefun callback);
+
 /*! @brief Processes all pending events.
  *
  *  This function processes only those events that are already in the event
@@ -4628,6 +5080,103 @@ GLFWAPI void glfwWaitEvents(void);
  */
 GLFWAPI void glfwWaitEventsTimeout(double timeout);
 
+/*! @brief Waits until events are queued or a deadline is reached and processes
+ *  them.
+ *
+ *  This function puts the calling thread to sleep until at least one event is
+ *  available in the event queue, or until the specified absolute deadline is
+ *  reached.  If one or more events are available, it behaves exactly like @ref
+ *  glfwPollEvents, i.e. the events in the queue are processed and the function
+ *  then returns immediately.  Processing events will cause the window and input
+ *  callbacks associated with those events to be called.
+ *
+ *  The deadline is a value of the raw timer, as returned by @ref
+ *  glfwGetTimerValue.  Unlike with @ref glfwWaitEventsTimeout, the time spent
+ *  waiting is measured from that fixed point rather than from when this
+ *  function is called, so loops that wait for a sequence of deadlines spaced
+ *  by a fixed number of ticks do not drift.  If the deadline has already
+ *  passed, this function behaves like @ref glfwPollEvents.
+ *
+ *  Since not all events are associated with callbacks, this function may return
+ *  without a callback having been called even if you are monitoring all
+ *  callbacks.
+ *
+ *  On some platforms, a window move, resize or menu operation will cause event
+ *  processing to block.  This is due to how event processing is designed on
+ *  those platforms.  You can use the
+ *  [window refresh callback](@ref window_refresh) to redraw the contents of
+ *  your window when necessary during such operations.
+ *
+ *  Event processing is not required for joystick input to work.
+ *
+ *  @param[in] deadline The raw timer value at which to stop waiting.
+ *
+ *  @errors Possible errors include @ref GLFW_NOT_INITIALIZED and @ref
+ *  GLFW_PLATFORM_ERROR.
+ *
+ *  @remark @wayland @x11 The wait uses an absolute deadline on the monotonic
+ *  clock and the remaining time is recomputed in integer nanoseconds whenever
+ *  the wait is interrupted.
+ *
+ *  @reentrancy This function must not be called from a callback.
+ *
+ *  @thread_safety This function must only be called from the main thread.
+ *
+ *  @sa @ref events
+ *  @sa @ref glfwWaitEventsTimeout
+ *  @sa @ref glfwGetTimerValue
+ *  @sa @ref glfwGetTimerFrequency
+ *
+ *  @since Added in version 3.5.
+ *
+ *  @ingroup window
+ */
+GLFWAPI void glfwWaitEventsUntil(uint64_t deadline);
+
+/*! @brief Waits until shortly before the next frame of the specified window,
+ *  processing events.
+ *
+ *  This function paces the calling thread to the refresh rate of the monitor
+ *  the specified window is displayed on, for applications that have disabled
+ *  vertical synchronization to reduce latency.  It returns the frame pacing
+ *  margin of the window before the next predicted vertical blank, processing
+ *  any events that arrive while waiting as if by @ref glfwWaitEventsUntil.
+ *
+ *  The first call starts a sequence of frames spaced by the refresh period.
+ *  If the application falls more than a frame behind, the frames it missed
+ *  are skipped and the sequence is restarted, also picking up any change of
+ *  refresh rate.
+ *
+ *  To wake up on time, this function sleeps until shortly before the target
+ *  time and then spins on the timer for the remainder.
+ *
+ *  @param[in] window The window to pace.
+ *
+ *  @errors Possible errors include @ref GLFW_NOT_INITIALIZED and @ref
+ *  GLFW_PLATFORM_ERROR.
+ *
+ *  @remark Full screen windows are paced to their monitor.  Windowed mode
+ *  windows are paced to the primary monitor, as the window position is not
+ *  available on all platforms.  If the refresh rate is not known, 60 Hz is
+ *  assumed.
+ *
+ *  @remark The predicted vertical blank is not synchronized to the display
+ *  hardware, only to its refresh rate.
+ *
+ *  @reentrancy This function must not be called from a callback.
+ *
+ *  @thread_safety This function must only be called from the main thread.
+ *
+ *  @sa @ref frame_pacing
+ *  @sa @ref glfwSetWindowFrameMargin
+ *  @sa @ref glfwWaitEventsUntil
+ *
+ *  @since Added in version 3.5.
+ *
+ *  @ingroup window
+ */
+GLFWAPI void glfwWaitForNextFrame(GLFWwindow* window);
+
 /*! @brief Posts an empty event to the event queue.
  *
  *  This function posts an empty event from the current thread to the event
@@ -4648,6 +5197,141 @@ GLFWAPI void glfwWaitEventsTimeout(double timeout);
  */
 GLFWAPI void glfwPostEmptyEvent(void);
 
+/*! @brief Adds an application file descriptor to the event wait.
+ *
+ *  This function adds the specified file descriptor to the set of file
+ *  descriptors that @ref glfwWaitEvents and @ref glfwWaitEventsTimeout wait
+ *  on, alongside those used by GLFW itself.  When the file descriptor becomes
+ *  ready for any of the specified conditions, the callback is called from
+ *  inside the event processing function and the wait ends, as if a window
+ *  system event had been received.  The file descriptor is also checked
+ *  without blocking by @ref glfwPollEvents.
+ *
+ *  This lets a single thread block on both window system events and
+ *  application I/O such as sockets and pipes, without busy polling or waking
+ *  the main thread with @ref glfwPostEmptyEvent from a helper thread.
+ *
+ *  If the file descriptor has already been added, its conditions, callback and
+ *  user pointer are replaced.
+ *
+ *  The file descriptor must be removed with @ref glfwRemoveEventFd before it
+ *  is closed.  All file descriptors are removed when the library is
+ *  terminated.
+ *
+ *  @param[in] fd The file descriptor to add.
+ *  @param[in] events A bit field of one or both of @ref GLFW_EVENT_FD_READ and
+ *  @ref GLFW_EVENT_FD_WRITE.
+ *  @param[in] callback The function to call when the file descriptor becomes
+ *  ready.
+ *  @param[in] user A user-defined pointer passed to the callback.
+ *  @return `GLFW_TRUE` if successful, or `GLFW_FALSE` if an
+ *  [error](@ref error_handling) occurred.
+ *
+ *  @errors Possible errors include @ref GLFW_NOT_INITIALIZED, @ref
+ *  GLFW_INVALID_VALUE, @ref GLFW_OUT_OF_MEMORY and @ref
+ *  GLFW_FEATURE_UNAVAILABLE.
+ *
+ *  @remark @win32 @macos Application file descriptors are not supported.  This
+ *  function will emit @ref GLFW_FEATURE_UNAVAILABLE.
+ *
+ *  @thread_safety This function must only be called from the main thread.
+ *
+ *  @sa @ref events_fd
+ *  @sa @ref glfwRemoveEventFd
+ *
+ *  @since Added in version 3.5.
+ *
+ *  @ingroup window
+ */
+GLFWAPI int glfwAddEventFd(int fd, int events, GLFWeventfdfun callback, void* user);
+
+/*! @brief Removes an application file descriptor from the event wait.
+ *
+ *  This function removes a file descriptor previously added with @ref
+ *  glfwAddEventFd.  Its callback will not be called again, even if the file
+ *  descriptor was ready during the current event processing.
+ *
+ *  This function may be called from an event file descriptor callback.
+ *
+ *  @param[in] fd The file descriptor to remove.
+ *
+ *  @errors Possible errors include @ref GLFW_NOT_INITIALIZED and @ref
+ *  GLFW_INVALID_VALUE.
+ *
+ *  @thread_safety This function must only be called from the main thread.
+ *
+ *  @sa @ref events_fd
+ *  @sa @ref glfwAddEventFd
+ *
+ *  @since Added in version 3.5.
+ *
+ *  @ingroup window
+ */
+GLFWAPI void glfwRemoveEventFd(int fd);
+
+/*! @brief Creates an event loop timer.
+ *
+ *  This function creates a timer that expires after the specified interval and
+ *  then, if it repeats, every interval after that.  The event wait functions
+ *  @ref glfwWaitEvents, @ref glfwWaitEventsTimeout and @ref glfwWaitEventsUntil
+ *  end their wait when a timer expires, and the timer callback is called from
+ *  inside those functions and @ref glfwPollEvents.
+ *
+ *  If a repeating timer falls behind by more than one interval, the missed
+ *  expirations are skipped rather than reported in a burst.  A timer that does
+ *  not repeat remains allocated after it has expired, until it is destroyed.
+ *
+ *  Any remaining timers are destroyed by @ref glfwTerminate.
+ *
+ *  @param[in] interval The interval, in seconds, until the timer expires.  This
+ *  must be a positive finite number.
+ *  @param[in] repeat `GLFW_TRUE` to expire every interval, or `GLFW_FALSE` to
+ *  expire once.
+ *  @param[in] callback The function to call when the timer expires.
+ *  @param[in] user A user-defined pointer passed to the callback.
+ *  @return The handle of the created timer, or `NULL` if an
+ *  [error](@ref error_handling) occurred.
+ *
+ *  @errors Possible errors include @ref GLFW_NOT_INITIALIZED, @ref
+ *  GLFW_INVALID_VALUE and @ref GLFW_OUT_OF_MEMORY.
+ *
+ *  @remark The timer is checked at the start and end of each event wait, so
+ *  a timer callback may be delayed by the processing of other events.
+ *
+ *  @thread_safety This function must only be called from the main thread.
+ *
+ *  @sa @ref events_timer
+ *  @sa @ref glfwDestroyTimer
+ *
+ *  @since Added in version 3.5.
+ *
+ *  @ingroup window
+ */
+GLFWAPI GLFWtimer* glfwCreateTimer(double interval, int repeat, GLFWtimerfun callback, void* user);
+
+/*! @brief Destroys an event loop timer.
+ *
+ *  This function destroys a timer previously created with @ref
+ *  glfwCreateTimer.  Its callback will not be called again.
+ *
+ *  This function may be called from a timer callback, including that of the
+ *  timer being destroyed.
+ *
+ *  @param[in] timer The timer to destroy, or `NULL`.
+ *
+ *  @errors Possible errors include @ref GLFW_NOT_INITIALIZED.
+ *
+ *  @thread_safety This function must only be called from the main thread.
+ *
+ *  @sa @ref events_timer
+ *  @sa @ref glfwCreateTimer
+ *
+ *  @since Added in version 3.5.
+ *
+ *  @ingroup window
+ */
+GLFWAPI void glfwDestroyTimer(GLFWtimer* timer);
+
 /*! @brief Returns the value of an input option for the specified window.
  *
  *  This function returns the value of an input option for the specified window.
@@ -6077,6 +6761,59 @@ GLFWAPI uint64_t glfwGetTimerValue(void);
  */
 GLFWAPI uint64_t glfwGetTimerFrequency(void);
 
+/*! @brief Creates contexts without windows that share with the specified one.
+ *
+ *  This function creates the specified number of OpenGL or OpenGL ES contexts
+ *  that share objects with the context of the specified window, without
+ *  creating any native windows.  They are intended for loading textures,
+ *  buffers and other objects on worker threads.
+ *
+ *  The new contexts use the same client API, context creation API, version,
+ *  profile and flags as the context they share with.  They have no default
+ *  framebuffer, so any rendering with them must be done to framebuffer
+ *  objects.  Depending on the context creation API, they are backed by
+ *  a surfaceless context, a small pbuffer or a small OSMesa buffer.
+ *
+ *  The returned handles may only be used with @ref glfwMakeContextCurrent,
+ *  @ref glfwGetCurrentContext, the context attributes of @ref
+ *  glfwGetWindowAttrib, the window user pointer functions and @ref
+ *  glfwDestroyWindow.  Swapping the buffers of these contexts or setting their
+ *  swap interval does nothing.  Passing them to any other window function
+ *  results in undefined behavior.
+ *
+ *  Contexts created by this function must be destroyed with @ref
+ *  glfwDestroyWindow before the window they share with.  Any remaining
+ *  contexts are destroyed by @ref glfwTerminate.
+ *
+ *  @param[in] window The window whose context to share with.
+ *  @param[in] count The number of contexts to create.
+ *  @param[out] contexts Where to store the handles of the created contexts.
+ *  This array must have at least `count` elements.
+ *  @return `GLFW_TRUE` if all contexts were created, or `GLFW_FALSE` if an
+ *  [error](@ref error_handling) occurred.  If any context could not be
+ *  created, the ones already created by this call are destroyed.
+ *
+ *  @errors Possible errors include @ref GLFW_NOT_INITIALIZED, @ref
+ *  GLFW_INVALID_VALUE, @ref GLFW_NO_WINDOW_CONTEXT, @ref
+ *  GLFW_API_UNAVAILABLE, @ref GLFW_VERSION_UNAVAILABLE, @ref
+ *  GLFW_FORMAT_UNAVAILABLE and @ref GLFW_PLATFORM_ERROR.
+ *
+ *  @remark @x11 The GLXFBConfig of the shared context must support pbuffers.
+ *
+ *  @remark @win32 The contexts use the device context of the window they
+ *  share with.
+ *
+ *  @thread_safety This function must only be called from the main thread.
+ *
+ *  @sa @ref context_shared
+ *  @sa @ref glfwMakeContextCurrent
+ *
+ *  @since Added in version 3.5.
+ *
+ *  @ingroup context
+ */
+GLFWAPI int glfwCreateSharedContexts(GLFWwindow* window, int count, GLFWwindow** contexts);
+
 /*! @brief Makes the context of the specified window current for the calling
  *  thread.
  *
@@ -6097,6 +6834,15 @@ GLFWAPI uint64_t glfwGetTimerFrequency(void);
  *  [GLFW_CONTEXT_RELEASE_BEHAVIOR](@ref GLFW_CONTEXT_RELEASE_BEHAVIOR_hint)
  *  hint.
  *
+ *  If the context is already current on the calling thread, this function
+ *  returns without calling the context creation API, except for OSMesa
+ *  contexts and EGL contexts on the Null platform, which resize their buffer or
+ *  pbuffer when made current.  If the
+ *  [GLFW_LAZY_CONTEXT_RELEASE](@ref GLFW_LAZY_CONTEXT_RELEASE_hint) init hint
+ *  is set, detaching the current context is deferred until another context is
+ *  made current on the calling thread, or until this function is called with
+ *  `NULL` again.
+ *
  *  The specified window must have an OpenGL or OpenGL ES context.  Specifying
  *  a window without a context will generate a @ref GLFW_NO_WINDOW_CONTEXT
  *  error.
@@ -6154,6 +6900,12 @@ GLFWAPI GLFWwindow* glfwGetCurrentContext(void);
  *  a window without a context will generate a @ref GLFW_NO_WINDOW_CONTEXT
  *  error.
  *
+ *  If the window was created with the
+ *  [GLFW_PRESENT_THREAD](@ref GLFW_PRESENT_THREAD_hint) hint, the context of
+ *  the window must be current on the calling thread.  The swap is then queued
+ *  for the present thread and the context is made non-current before this
+ *  function returns.  See @ref present_thread for details.
+ *
  *  This function does not apply to Vulkan.  If you are rendering with Vulkan,
  *  see `vkQueuePresentKHR` instead.
  *
@@ -6168,6 +6920,7 @@ GLFWAPI GLFWwindow* glfwGetCurrentContext(void);
  *  @thread_safety This function may be called from any thread.
  *
  *  @sa @ref buffer_swap
+ *  @sa @ref present_thread
  *  @sa @ref glfwSwapInterval
  *
  *  @since Added in version 1.0.
@@ -6177,6 +6930,171 @@ GLFWAPI GLFWwindow* glfwGetCurrentContext(void);
  */
 GLFWAPI void glfwSwapBuffers(GLFWwindow* window);
 
+/*! @brief Swaps the buffers of the specified window, with damage rectangles.
+ *
+ *  This function swaps the front and back buffers of the specified window like
+ *  @ref glfwSwapBuffers, while telling the window system which parts of the
+ *  frame have changed since the previous one.  The window system may then
+ *  copy and recomposite only those parts.
+ *
+ *  Each rectangle is four integers, the x- and y-coordinates of its lower-left
+ *  corner followed by its width and height, in pixels of the framebuffer with
+ *  the origin in the lower-left corner, as with `glScissor`.
+ *
+ *  If the context creation API does not support damage rectangles, or if
+ *  `count` is zero, the whole buffer is swapped as by @ref glfwSwapBuffers.
+ *
+ *  @param[in] window The window whose buffers to swap.
+ *  @param[in] rects An array of `4 * count` integers describing the damaged
+ *  rectangles, or `NULL` if `count` is zero.
+ *  @param[in] count The number of damaged rectangles.
+ *
+ *  @errors Possible errors include @ref GLFW_NOT_INITIALIZED, @ref
+ *  GLFW_NO_WINDOW_CONTEXT, @ref GLFW_INVALID_VALUE and @ref
+ *  GLFW_PLATFORM_ERROR.
+ *
+ *  @remark __EGL:__ The context of the specified window must be current on the
+ *  calling thread.  Damage rectangles are passed on if either the
+ *  `EGL_KHR_swap_buffers_with_damage` or `EGL_EXT_swap_buffers_with_damage`
+ *  extension is available.
+ *
+ *  @remark Damage rectangles are currently ignored for all context creation
+ *  APIs other than EGL.
+ *
+ *  @pointer_lifetime The array of rectangles is only read before this
+ *  function returns.
+ *
+ *  @thread_safety This function may be called from any thread.
+ *
+ *  @sa @ref buffer_swap_damage
+ *  @sa @ref glfwSwapBuffers
+ *
+ *  @since Added in version 3.5.
+ *
+ *  @ingroup window
+ */
+GLFWAPI void glfwSwapBuffersWithDamage(GLFWwindow* window, const int* rects, int count);
+
+/*! @brief Retrieves the buffer swap statistics of the specified window.
+ *
+ *  This function retrieves the timing of the buffer swaps of the specified
+ *  window since its statistics were enabled or last reset.  Statistics are
+ *  only recorded while the [GLFW_SWAP_STATISTICS](@ref GLFW_SWAP_STATISTICS_attrib)
+ *  window attribute is enabled.
+ *
+ *  @param[in] window The window whose statistics to retrieve.
+ *  @param[out] stats Where to store the statistics.
+ *  @return `GLFW_TRUE` if statistics are enabled for the window, or
+ *  `GLFW_FALSE` if they are not or an [error](@ref error_handling) occurred.
+ *  If `GLFW_FALSE` is returned, all members of the struct are set to zero.
+ *
+ *  @errors Possible errors include @ref GLFW_NOT_INITIALIZED.
+ *
+ *  @thread_safety This function may be called from any thread.  Access is not
+ *  synchronized with buffer swaps on other threads.
+ *
+ *  @sa @ref swap_statistics
+ *  @sa @ref glfwResetSwapStatistics
+ *
+ *  @since Added in version 3.5.
+ *
+ *  @ingroup window
+ */
+GLFWAPI int glfwGetSwapStatistics(GLFWwindow* window, GLFWswapstats* stats);
+
+/*! @brief Resets the buffer swap statistics of the specified window.
+ *
+ *  This function resets the buffer swap statistics of the specified window to
+ *  zero, for example after each telemetry report.  The refresh rate used to
+ *  detect missed deadlines is also updated.
+ *
+ *  @param[in] window The window whose statistics to reset.
+ *
+ *  @errors Possible errors include @ref GLFW_NOT_INITIALIZED.
+ *
+ *  @thread_safety This function must only be called from the main thread.
+ *
+ *  @sa @ref swap_statistics
+ *  @sa @ref glfwGetSwapStatistics
+ *
+ *  @since Added in version 3.5.
+ *
+ *  @ingroup window
+ */
+GLFWAPI void glfwResetSwapStatistics(GLFWwindow* window);
+
+/*! @brief Starts capturing the frames of the specified window.
+ *
+ *  This function starts capturing every frame of the specified window.  Each
+ *  time @ref glfwSwapBuffers is called for the window, the back buffer is read
+ *  back and queued, and a worker thread writes queued frames in the specified
+ *  format.  If the path ends with a directory separator, each frame is written
+ *  to a file in that directory named after the number of its buffer swap, for
+ *  example `00000042.png`.  Otherwise all frames are written in order to the
+ *  file or named pipe at that path.  `SIGPIPE` is blocked on the worker
+ *  thread, so a pipe whose reader has gone away only makes writing fail.
+ *
+ *  At most `count` frames are queued.  If the worker has not caught up when
+ *  the queue is full, the frame is dropped instead of waiting for it and the
+ *  @ref GLFW_COUNTER_DROPPED_FRAMES counter is incremented.
+ *
+ *  If frames were already being captured for the window, that capture is
+ *  first stopped as if by @ref glfwStopFrameCapture.
+ *
+ *  @param[in] window The window whose frames to capture.
+ *  @param[in] path The UTF-8 encoded path of the output file or directory.
+ *  @param[in] format The format of captured frames.  This must be one of
+ *  @ref GLFW_CAPTURE_RAW or @ref GLFW_CAPTURE_PNG.
+ *  @param[in] count The maximum number of frames waiting to be written.
+ *  @return `GLFW_TRUE` if successful, or `GLFW_FALSE` if an
+ *  [error](@ref error_handling) occurred.
+ *
+ *  @errors Possible errors include @ref GLFW_NOT_INITIALIZED, @ref
+ *  GLFW_NO_WINDOW_CONTEXT, @ref GLFW_INVALID_ENUM, @ref GLFW_INVALID_VALUE and
+ *  @ref GLFW_PLATFORM_ERROR.
+ *
+ *  @remark A frame can only be read back if the context of the window is
+ *  current on the thread calling @ref glfwSwapBuffers.  Other frames are
+ *  dropped.
+ *
+ *  @remark Errors writing frames are reported from the worker thread.
+ *
+ *  @pointer_lifetime The specified path is copied before this function
+ *  returns.
+ *
+ *  @thread_safety This function must only be called from the main thread.
+ *
+ *  @sa @ref frame_capture
+ *  @sa @ref glfwStopFrameCapture
+ *
+ *  @since Added in version 3.5.
+ *
+ *  @ingroup window
+ */
+GLFWAPI int glfwStartFrameCapture(GLFWwindow* window, const char* path, int format, int count);
+
+/*! @brief Stops capturing the frames of the specified window.
+ *
+ *  This function stops capturing the frames of the specified window.  It
+ *  waits until all frames already queued have been written.
+ *
+ *  Destroying a window also stops capturing its frames.
+ *
+ *  @param[in] window The window whose frames to stop capturing.
+ *
+ *  @errors Possible errors include @ref GLFW_NOT_INITIALIZED.
+ *
+ *  @thread_safety This function must only be called from the main thread.
+ *
+ *  @sa @ref frame_capture
+ *  @sa @ref glfwStartFrameCapture
+ *
+ *  @since Added in version 3.5.
+ *
+ *  @ingroup window
+ */
+GLFWAPI void glfwStopFrameCapture(GLFWwindow* window);
+
 /*! @brief Sets the swap interval for the current context.
  *
  *  This function sets the swap interval for the current OpenGL or OpenGL ES
@@ -6285,6 +7203,10 @@ GLFWAPI int glfwExtensionSupported(const char* extension);
  *  @remark The address of a given function is not guaranteed to be the same
  *  between contexts.
  *
+ *  @remark Addresses are cached after the first query, per context or per
+ *  share group where addresses do not depend on the context, so querying
+ *  a name again is cheap.
+ *
  *  @remark This function may return a non-`NULL` address despite the
  *  associated version or extension not being available.  Always check the
  *  context version or extension string first.
@@ -6303,6 +7225,46 @@ GLFWAPI int glfwExtensionSupported(const char* extension);
  */
 GLFWAPI GLFWglproc glfwGetProcAddress(const char* procname);
 
+/*! @brief Returns the addresses of the specified functions for the current
+ *  context.
+ *
+ *  This function returns the addresses of the specified OpenGL or OpenGL ES
+ *  [core or extension functions](@ref context_glext) for the current context,
+ *  like calling @ref glfwGetProcAddress for each name but with less overhead.
+ *  This is intended for loaders that resolve a whole table of entry points.
+ *
+ *  A context must be current on the calling thread.  Calling this function
+ *  without a current context will cause a @ref GLFW_NO_CURRENT_CONTEXT error.
+ *
+ *  @param[in] procnames An array of ASCII encoded function names.
+ *  @param[out] procs Where to store the address of each function, or `NULL`
+ *  if it is not supported.
+ *  @param[in] count The number of elements in the arrays.
+ *  @return The number of functions found, or zero if an
+ *  [error](@ref error_handling) occurred.
+ *
+ *  @errors Possible errors include @ref GLFW_NOT_INITIALIZED, @ref
+ *  GLFW_NO_CURRENT_CONTEXT, @ref GLFW_INVALID_VALUE and @ref
+ *  GLFW_PLATFORM_ERROR.
+ *
+ *  @remark The same remarks as for @ref glfwGetProcAddress apply to each
+ *  returned address.
+ *
+ *  @pointer_lifetime The returned function pointers are valid until the
+ *  context is destroyed or the library is terminated.
+ *
+ *  @thread_safety This function may be called from any thread.
+ *
+ *  @sa @ref context_glext
+ *  @sa @ref glfwGetProcAddress
+ *
+ *  @since Added in version 3.5.
+ *
+ *  @ingroup context
+ */
+GLFWAPI int glfwGetProcAddresses(const char* const* procnames,
+                                 GLFWglproc* procs, int count);
+
 /*! @brief Returns whether the Vulkan loader and an ICD have been found.
  *
  *  This function returns whether the Vulkan loader and any minimally functional
@@ -6453,6 +7415,58 @@ GLFWAPI GLFWvkproc glfwGetInstanceProcAddress(VkInstance instance, const char* p
  */
 GLFWAPI int glfwGetPhysicalDevicePresentationSupport(VkInstance instance, VkPhysicalDevice device, uint32_t queuefamily);
 
+/*! @brief Returns whether each queue family of a device can present images.
+ *
+ *  This function returns whether each queue family of the specified physical
+ *  device supports presentation to the platform GLFW was built for, like @ref
+ *  glfwGetPhysicalDevicePresentationSupport does for a single queue family.
+ *
+ *  If `supported` is `NULL`, the number of queue families of the device is
+ *  stored in `count`.  Otherwise `count` must hold the number of elements of
+ *  `supported`, and the number of queue families that were queried is stored
+ *  in it.
+ *
+ *  The instance functions needed for the query are resolved only the first time
+ *  they are used with each instance.
+ *
+ *  If Vulkan or the required window surface creation instance extensions are
+ *  not available on the machine, or if the specified instance was not created
+ *  with the required extensions, this function returns `GLFW_FALSE` and
+ *  generates a @ref GLFW_API_UNAVAILABLE error.
+ *
+ *  @param[in] instance The instance that the physical device belongs to.
+ *  @param[in] device The physical device whose queue families to query.
+ *  @param[in,out] count Where the number of elements of `supported` is read
+ *  from and where the number of queue families is stored.
+ *  @param[out] supported Where to store `GLFW_TRUE` or `GLFW_FALSE` for each
+ *  queue family, in order of index, or `NULL`.
+ *  @return `GLFW_TRUE` if successful, or `GLFW_FALSE` if an
+ *  [error](@ref error_handling) occurred.
+ *
+ *  @errors Possible errors include @ref GLFW_NOT_INITIALIZED, @ref
+ *  GLFW_API_UNAVAILABLE and @ref GLFW_PLATFORM_ERROR.
+ *
+ *  @remark @macos This function currently reports every queue family as
+ *  supported, as the `VK_MVK_macos_surface` and `VK_EXT_metal_surface`
+ *  extensions do not provide a `vkGetPhysicalDevice*PresentationSupport` type
+ *  function.
+ *
+ *  @remark The resolved functions are kept until the library is terminated.  If
+ *  an instance is destroyed and a new one created with the same handle, the
+ *  functions of the old instance are used.
+ *
+ *  @thread_safety This function may be called from any thread.  For
+ *  synchronization details of Vulkan objects, see the Vulkan specification.
+ *
+ *  @sa @ref vulkan_present
+ *  @sa @ref glfwGetPhysicalDevicePresentationSupport
+ *
+ *  @since Added in version 3.5.
+ *
+ *  @ingroup vulkan
+ */
+GLFWAPI int glfwGetQueueFamilyPresentationSupport(VkInstance instance, VkPhysicalDevice device, uint32_t* count, int* supported);
+
 /*! @brief Creates a Vulkan surface for the specified window.
  *
  *  This function creates a Vulkan surface for the specified window.
@@ -590,6 +590,10 @@ GLFWAPI EGLSurface glfwGetEGLSurface(GLFWwindow* window);
 
 #if defined(GLFW_EXPOSE_NATIVE_OSMESA)
 /*! @brief Retrieves the color buffer associated with the specified window.
+ *
+ *  If color buffers have been set with @ref glfwSetOSMesaColorBuffers, this
+ *  function returns the buffer rendered to in the current frame, along with
+ *  the size of the buffers.
  *
  *  @param[in] window The window whose color buffer to retrieve.
  *  @param[out] width Where to store the width of the color buffer, or `NULL`.
@@ -607,12 +611,62 @@ GLFWAPI EGLSurface glfwGetEGLSurface(GLFWwindow* window);
  *  @thread_safety This function may be called from any thread.  Access is not
  *  synchronized.
  *
+ *  @sa @ref glfwSetOSMesaColorBuffers
+ *
  *  @since Added in version 3.3.
  *
  *  @ingroup native
  */
 GLFWAPI int glfwGetOSMesaColorBuffer(GLFWwindow* window, int* width, int* height, int* format, void** buffer);
 
+/*! @brief Sets the color buffers rendered to by the specified window.
+ *
+ *  This function makes the OSMesa context of the specified window render
+ *  directly into memory owned by the caller instead of a buffer allocated by
+ *  GLFW.  Each buffer must hold `width * height` pixels of 8-bit RGBA and must
+ *  remain valid until it is replaced or the window is destroyed.
+ *
+ *  The context renders at the size of the buffers, regardless of the size of
+ *  the window framebuffer, and no buffer is reallocated when the window is
+ *  resized.  Rendering starts in the first buffer and moves on to the next, in
+ *  order, every time @ref glfwSwapBuffers is called.  The frame in the
+ *  previous buffer is complete when @ref glfwSwapBuffers returns, if the
+ *  context was current on the calling thread.
+ *
+ *  Passing a count of zero makes the context use a buffer allocated by GLFW
+ *  again.
+ *
+ *  While color buffers are set, @ref glfwGetOSMesaColorBuffer returns the
+ *  buffer rendered to in the current frame instead of the buffer allocated by
+ *  GLFW.
+ *
+ *  @param[in] window The window whose color buffers to set.
+ *  @param[in] width The width, in pixels, of each buffer.
+ *  @param[in] height The height, in pixels, of each buffer.
+ *  @param[in] count The number of buffers, or zero.
+ *  @param[in] buffers The addresses of the buffers, or `NULL` if `count` is
+ *  zero.
+ *  @return `GLFW_TRUE` if successful, or `GLFW_FALSE` if an
+ *  [error](@ref error_handling) occurred.
+ *
+ *  @errors Possible errors include @ref GLFW_NOT_INITIALIZED, @ref
+ *  GLFW_NO_WINDOW_CONTEXT, @ref GLFW_INVALID_VALUE and @ref
+ *  GLFW_OUT_OF_MEMORY.
+ *
+ *  @pointer_lifetime The array of buffer addresses is copied before this
+ *  function returns.  The buffers themselves are owned by the caller.
+ *
+ *  @thread_safety This function may be called from any thread.  Access is not
+ *  synchronized.
+ *
+ *  @sa @ref glfwGetOSMesaColorBuffer
+ *
+ *  @since Added in version 3.5.
+ *
+ *  @ingroup native
+ */
+GLFWAPI int glfwSetOSMesaColorBuffers(GLFWwindow* window, int width, int height, int count, void* const* buffers);
+
 /*! @brief Retrieves the depth buffer associated with the specified window.
  *
  *  @param[in] window The window whose depth buffer to retrieve.
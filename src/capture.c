@@ -0,0 +1,468 @@
+//========================================================================
+// GLFW 3.5 - www.glfw.org
+//------------------------------------------------------------------------
+// Copyright (c) 2006-2016 Camilla Löwy <elmindreda@glfw.org>
+//
+// This software is provided 'as-is', without any express or implied
+// warranty. In no event will the authors be held liable for any damages
+// arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it
+// freely, subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented; you must not
+//    claim that you wrote the original software. If you use this software
+//    in a product, an acknowledgment in the product documentation would
+//    be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such, and must not
+//    be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source
+//    distribution.
+//
+//========================================================================
+
+#include "internal.h"
+
+#include <assert.h>
+#include <stdio.h>
+#include <string.h>
+
+#if defined(GLFW_BUILD_POSIX_THREAD)
+ #include <signal.h>
+#endif
+
+// NOTE: The stdio writers are not disabled, as that also leaves the HDR
+//       callback writer declared but not defined
+#define STB_IMAGE_WRITE_STATIC
+#define STB_IMAGE_WRITE_IMPLEMENTATION
+#define STBIW_MALLOC(size) _glfw_calloc(size, 1)
+#define STBIW_REALLOC(block, size) _glfw_realloc(block, size)
+#define STBIW_FREE(block) _glfw_free(block)
+
+// Only the PNG writer is used and all writers are private to this file, which
+// makes the compiler warn about the others
+#if defined(__GNUC__)
+ #pragma GCC diagnostic push
+ #pragma GCC diagnostic ignored "-Wunused-function"
+#endif
+
+#include "stb_image_write.h"
+
+#if defined(__GNUC__)
+ #pragma GCC diagnostic pop
+#endif
+
+#define GL_PACK_ALIGNMENT 0x0d05
+#define GL_RGBA 0x1908
+#define GL_READ_FRAMEBUFFER 0x8ca8
+#define GL_READ_FRAMEBUFFER_BINDING 0x8caa
+
+typedef void (APIENTRY * PFNGLREADPIXELSPROC)(GLint,GLint,GLint,GLint,GLenum,GLenum,void*);
+typedef void (APIENTRY * PFNGLPIXELSTOREIPROC)(GLenum,GLint);
+typedef void (APIENTRY * PFNGLBINDFRAMEBUFFERPROC)(GLenum,GLuint);
+
+// A frame read back from the window, waiting to be written
+//
+typedef struct _GLFWcaptureframe
+{
+    unsigned char*      pixels;
+    size_t              size;
+    int                 width;
+    int                 height;
+    uint64_t            number;
+} _GLFWcaptureframe;
+
+// Frame capture state of a window
+//
+struct _GLFWcapture
+{
+    char*               path;
+    int                 format;
+    GLFWbool            directory;
+    FILE*               file;
+    GLFWbool            failed;
+    uint64_t            frameNumber;
+
+    PFNGLREADPIXELSPROC      ReadPixels;
+    PFNGLPIXELSTOREIPROC     PixelStorei;
+    PFNGLBINDFRAMEBUFFERPROC BindFramebuffer;
+
+    // The frames from first to first + queued - 1 wrap around the array and
+    // are owned by the worker, all others by the thread swapping buffers
+    _GLFWcaptureframe*  frames;
+    int                 count;
+    int                 first;
+    int                 queued;
+    GLFWbool            stop;
+
+    _GLFWmutex          mutex;
+    _GLFWcond           cond;
+    _GLFWthread         thread;
+};
+
+static void writeToFile(void* context, void* data, int size)
+{
+    FILE* file = context;
+    fwrite(data, 1, size, file);
+}
+
+// Writes a frame, stored bottom row first as returned by glReadPixels, to the
+// specified file
+//
+static GLFWbool writeFrame(_GLFWcapture* capture,
+                           const _GLFWcaptureframe* frame,
+                           FILE* file)
+{
+    const size_t stride = (size_t) frame->width * 4;
+    const unsigned char* last = frame->pixels + stride * (frame->height - 1);
+
+    if (capture->format == GLFW_CAPTURE_PNG)
+    {
+        // A negative stride makes the image be written top row first
+        if (!stbi_write_png_to_func(writeToFile, file,
+                                    frame->width, frame->height, 4,
+                                    last, -(int) stride))
+        {
+            return GLFW_FALSE;
+        }
+    }
+    else
+    {
+        int y;
+
+        for (y = 0;  y < frame->height;  y++)
+            fwrite(last - stride * y, 1, stride, file);
+    }
+
+    return fflush(file) == 0 && !ferror(file);
+}
+
+static void writeCapturedFrame(_GLFWcapture* capture,
+                               const _GLFWcaptureframe* frame)
+{
+    if (capture->failed)
+        return;
+
+    if (capture->directory)
+    {
+        char path[4096];
+        FILE* file;
+
+        snprintf(path, sizeof(path), "%s%08llu.%s",
+                 capture->path,
+                 (unsigned long long) frame->number,
+                 capture->format == GLFW_CAPTURE_PNG ? "png" : "rgba");
+
+        file = fopen(path, "wb");
+        if (!file)
+        {
+            _glfwInputError(GLFW_PLATFORM_ERROR,
+                            "Failed to create frame capture file %s", path);
+            capture->failed = GLFW_TRUE;
+            return;
+        }
+
+        if (!writeFrame(capture, frame, file))
+            capture->failed = GLFW_TRUE;
+
+        fclose(file);
+    }
+    else
+    {
+        if (!writeFrame(capture, frame, capture->file))
+            capture->failed = GLFW_TRUE;
+    }
+
+    if (capture->failed)
+    {
+        _glfwInputError(GLFW_PLATFORM_ERROR,
+                        "Failed to write captured frame %llu",
+                        (unsigned long long) frame->number);
+    }
+}
+
+// Writes queued frames until capture is stopped and the queue is empty
+//
+static void captureThreadMain(void* argument)
+{
+    _GLFWcapture* capture = argument;
+
+#if defined(GLFW_BUILD_POSIX_THREAD)
+    // Writing to a pipe whose reader has gone away raises SIGPIPE, which would
+    // terminate the application, so it is blocked for this thread and the
+    // write fails with EPIPE instead
+    sigset_t set;
+    sigemptyset(&set);
+    sigaddset(&set, SIGPIPE);
+    pthread_sigmask(SIG_BLOCK, &set, NULL);
+#endif
+
+    _glfwPlatformLockMutex(&capture->mutex);
+
+    for (;;)
+    {
+        while (!capture->queued && !capture->stop)
+            _glfwPlatformWaitCond(&capture->cond, &capture->mutex);
+
+        if (!capture->queued)
+            break;
+
+        const _GLFWcaptureframe* frame = capture->frames + capture->first;
+
+        _glfwPlatformUnlockMutex(&capture->mutex);
+        writeCapturedFrame(capture, frame);
+        _glfwPlatformLockMutex(&capture->mutex);
+
+        capture->first = (capture->first + 1) % capture->count;
+        capture->queued--;
+    }
+
+    _glfwPlatformUnlockMutex(&capture->mutex);
+}
+
+
+//////////////////////////////////////////////////////////////////////////
+//////                       GLFW internal API                      //////
+//////////////////////////////////////////////////////////////////////////
+
+// Reads the back buffer of the window into the next free frame of the queue,
+// or drops the frame if the worker has fallen behind
+//
+void _glfwCaptureFrame(_GLFWwindow* window)
+{
+    _GLFWcapture* capture = window->capture;
+    _GLFWcaptureframe* frame;
+    GLint alignment, framebuffer = 0;
+    int width, height;
+    size_t size;
+
+    // Frames are numbered by buffer swap, so dropped frames leave gaps
+    const uint64_t number = capture->frameNumber++;
+
+    // Frames can only be read back while the context is current
+    if (_glfwPlatformGetTls(&_glfw.contextSlot) != window)
+    {
+        _glfwCountDroppedFrame();
+        return;
+    }
+
+    if (!capture->ReadPixels)
+    {
+        capture->ReadPixels = (PFNGLREADPIXELSPROC)
+            window->context.getProcAddress("glReadPixels");
+        capture->PixelStorei = (PFNGLPIXELSTOREIPROC)
+            window->context.getProcAddress("glPixelStorei");
+
+        if (window->context.major >= 3)
+        {
+            capture->BindFramebuffer = (PFNGLBINDFRAMEBUFFERPROC)
+                window->context.getProcAddress("glBindFramebuffer");
+        }
+
+        if (!capture->ReadPixels || !capture->PixelStorei)
+        {
+            _glfwInputError(GLFW_PLATFORM_ERROR,
+                            "Failed to load frame capture entry points");
+            _glfwCountDroppedFrame();
+            return;
+        }
+    }
+
+    _glfwPlatformLockMutex(&capture->mutex);
+
+    if (capture->queued == capture->count)
+    {
+        _glfwPlatformUnlockMutex(&capture->mutex);
+        _glfwCountDroppedFrame();
+        return;
+    }
+
+    // This frame is not touched by the worker until it has been queued
+    frame = capture->frames + (capture->first + capture->queued) % capture->count;
+
+    _glfwPlatformUnlockMutex(&capture->mutex);
+
+    _glfw.platform.getFramebufferSize(window, &width, &height);
+    if (width <= 0 || height <= 0)
+    {
+        _glfwCountDroppedFrame();
+        return;
+    }
+
+    size = (size_t) width * height * 4;
+    if (frame->size < size)
+    {
+        unsigned char* pixels = _glfw_realloc(frame->pixels, size);
+        if (!pixels)
+        {
+            _glfwInputError(GLFW_OUT_OF_MEMORY, NULL);
+            _glfwCountDroppedFrame();
+            return;
+        }
+
+        frame->pixels = pixels;
+        frame->size = size;
+    }
+
+    window->context.GetIntegerv(GL_PACK_ALIGNMENT, &alignment);
+    capture->PixelStorei(GL_PACK_ALIGNMENT, 1);
+
+    if (capture->BindFramebuffer)
+    {
+        window->context.GetIntegerv(GL_READ_FRAMEBUFFER_BINDING, &framebuffer);
+        if (framebuffer)
+            capture->BindFramebuffer(GL_READ_FRAMEBUFFER, 0);
+    }
+
+    capture->ReadPixels(0, 0, width, height, GL_RGBA, GL_UNSIGNED_BYTE, frame->pixels);
+
+    if (framebuffer)
+        capture->BindFramebuffer(GL_READ_FRAMEBUFFER, framebuffer);
+
+    capture->PixelStorei(GL_PACK_ALIGNMENT, alignment);
+
+    frame->width = width;
+    frame->height = height;
+    frame->number = number;
+
+    _glfwPlatformLockMutex(&capture->mutex);
+    capture->queued++;
+    _glfwPlatformSignalCond(&capture->cond);
+    _glfwPlatformUnlockMutex(&capture->mutex);
+}
+
+// Writes any frames still queued and frees the frame capture state
+//
+void _glfwStopCapture(_GLFWwindow* window)
+{
+    _GLFWcapture* capture = window->capture;
+    int i;
+
+    if (!capture)
+        return;
+
+    if (capture->thread.function)
+    {
+        _glfwPlatformLockMutex(&capture->mutex);
+        capture->stop = GLFW_TRUE;
+        _glfwPlatformSignalCond(&capture->cond);
+        _glfwPlatformUnlockMutex(&capture->mutex);
+
+        _glfwPlatformJoinThread(&capture->thread);
+    }
+
+    _glfwPlatformDestroyCond(&capture->cond);
+    _glfwPlatformDestroyMutex(&capture->mutex);
+
+    if (capture->file)
+        fclose(capture->file);
+
+    for (i = 0;  i < capture->count;  i++)
+        _glfw_free(capture->frames[i].pixels);
+
+    _glfw_free(capture->frames);
+    _glfw_free(capture->path);
+    _glfw_free(capture);
+
+    window->capture = NULL;
+}
+
+
+//////////////////////////////////////////////////////////////////////////
+//////                        GLFW public API                       //////
+//////////////////////////////////////////////////////////////////////////
+
+GLFWAPI int glfwStartFrameCapture(GLFWwindow* handle, const char* path,
+                                  int format, int count)
+{
+    _GLFWcapture* capture;
+    size_t length;
+
+    _GLFW_REQUIRE_INIT_OR_RETURN(GLFW_FALSE);
+
+    _GLFWwindow* window = (_GLFWwindow*) handle;
+    assert(window != NULL);
+    assert(path != NULL);
+
+    if (window->context.client == GLFW_NO_API || window->contextOnly)
+    {
+        _glfwInputError(GLFW_NO_WINDOW_CONTEXT,
+                        "Cannot capture frames of a window that has no OpenGL or OpenGL ES context");
+        return GLFW_FALSE;
+    }
+
+    if (format != GLFW_CAPTURE_RAW && format != GLFW_CAPTURE_PNG)
+    {
+        _glfwInputError(GLFW_INVALID_ENUM, "Invalid frame capture format 0x%08X", format);
+        return GLFW_FALSE;
+    }
+
+    length = strlen(path);
+    if (!length || count <= 0)
+    {
+        _glfwInputError(GLFW_INVALID_VALUE,
+                        "Invalid frame capture path \"%s\" or frame count %i",
+                        path, count);
+        return GLFW_FALSE;
+    }
+
+    _glfwStopCapture(window);
+
+    capture = _glfw_calloc(1, sizeof(_GLFWcapture));
+    if (!capture)
+    {
+        _glfwInputError(GLFW_OUT_OF_MEMORY, NULL);
+        return GLFW_FALSE;
+    }
+
+    window->capture = capture;
+    capture->path = _glfw_strdup(path);
+    capture->format = format;
+    capture->directory = path[length - 1] == '/' || path[length - 1] == '\\';
+    capture->frames = _glfw_calloc(count, sizeof(_GLFWcaptureframe));
+    capture->count = count;
+
+    if (!capture->path || !capture->frames)
+    {
+        _glfwInputError(GLFW_OUT_OF_MEMORY, NULL);
+        capture->count = 0;
+        _glfwStopCapture(window);
+        return GLFW_FALSE;
+    }
+
+    if (!capture->directory)
+    {
+        capture->file = fopen(path, "wb");
+        if (!capture->file)
+        {
+            _glfwInputError(GLFW_PLATFORM_ERROR,
+                            "Failed to open frame capture file %s", path);
+            _glfwStopCapture(window);
+            return GLFW_FALSE;
+        }
+    }
+
+    if (!_glfwPlatformCreateMutex(&capture->mutex) ||
+        !_glfwPlatformCreateCond(&capture->cond) ||
+        !_glfwPlatformCreateThread(&capture->thread, captureThreadMain, capture))
+    {
+        _glfwStopCapture(window);
+        return GLFW_FALSE;
+    }
+
+    return GLFW_TRUE;
+}
+
+GLFWAPI void glfwStopFrameCapture(GLFWwindow* handle)
+{
+    _GLFW_REQUIRE_INIT();
+
+    _GLFWwindow* window = (_GLFWwindow*) handle;
+    assert(window != NULL);
+
+    _glfwStopCapture(window);
+}
+
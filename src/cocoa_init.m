@@ -524,6 +524,7 @@ GLFWbool _glfwConnectCocoa(int platformID, _GLFWplatform* platform)
         .setGammaRamp = _glfwSetGammaRampCocoa,
         .createWindow = _glfwCreateWindowCocoa,
         .destroyWindow = _glfwDestroyWindowCocoa,
+        .createSharedContext = _glfwCreateSharedContextCocoa,
         .setWindowTitle = _glfwSetWindowTitleCocoa,
         .setWindowIcon = _glfwSetWindowIconCocoa,
         .getWindowPos = _glfwGetWindowPosCocoa,
@@ -555,9 +556,11 @@ GLFWbool _glfwConnectCocoa(int platformID, _GLFWplatform* platform)
         .setWindowFloating = _glfwSetWindowFloatingCocoa,
         .setWindowOpacity = _glfwSetWindowOpacityCocoa,
         .setWindowMousePassthrough = _glfwSetWindowMousePassthroughCocoa,
+        .endWindowUpdate = _glfwEndWindowUpdateCocoa,
         .pollEvents = _glfwPollEventsCocoa,
         .waitEvents = _glfwWaitEventsCocoa,
         .waitEventsTimeout = _glfwWaitEventsTimeoutCocoa,
+        .waitEventsUntil = _glfwWaitEventsUntilCocoa,
         .postEmptyEvent = _glfwPostEmptyEventCocoa,
         .getEGLPlatform = _glfwGetEGLPlatformCocoa,
         .getEGLNativeDisplay = _glfwGetEGLNativeDisplayCocoa,
@@ -1018,6 +1018,22 @@ void _glfwDestroyWindowCocoa(_GLFWwindow* window)
     } // autoreleasepool
 }
 
+GLFWbool _glfwCreateSharedContextCocoa(_GLFWwindow* window,
+                                       const _GLFWctxconfig* ctxconfig,
+                                       const _GLFWfbconfig* fbconfig)
+{
+    @autoreleasepool {
+
+    if (ctxconfig->source == GLFW_NATIVE_CONTEXT_API)
+        return _glfwCreateContextNSGL(window, ctxconfig, fbconfig);
+    else if (ctxconfig->source == GLFW_EGL_CONTEXT_API)
+        return _glfwCreateContextEGL(window, ctxconfig, fbconfig);
+    else
+        return _glfwCreateContextOSMesa(window, ctxconfig, fbconfig);
+
+    } // autoreleasepool
+}
+
 void _glfwSetWindowTitleCocoa(_GLFWwindow* window, const char* title)
 {
     @autoreleasepool {
@@ -1489,6 +1505,11 @@ void _glfwSetWindowMousePassthroughCocoa(_GLFWwindow* window, GLFWbool enabled)
     }
 }
 
+void _glfwEndWindowUpdateCocoa(_GLFWwindow* window)
+{
+    // Window updates are applied immediately by AppKit
+}
+
 float _glfwGetWindowOpacityCocoa(_GLFWwindow* window)
 {
     @autoreleasepool {
@@ -1568,6 +1589,17 @@ void _glfwWaitEventsTimeoutCocoa(double timeout)
     } // autoreleasepool
 }
 
+void _glfwWaitEventsUntilCocoa(uint64_t deadline)
+{
+    const uint64_t now = _glfwPlatformGetTimerValue();
+    double timeout = 0.0;
+
+    if (deadline > now)
+        timeout = (deadline - now) / (double) _glfwPlatformGetTimerFrequency();
+
+    _glfwWaitEventsTimeoutCocoa(timeout);
+}
+
 void _glfwPostEmptyEventCocoa(void)
 {
     @autoreleasepool {
@@ -1938,8 +1970,13 @@ void _glfwGetRequiredInstanceExtensionsCocoa(char** extensions)
 
 GLFWbool _glfwGetPhysicalDevicePresentationSupportCocoa(VkInstance instance,
                                                         VkPhysicalDevice device,
-                                                        uint32_t queuefamily)
+                                                        uint32_t first,
+                                                        uint32_t count,
+                                                        int* supported)
 {
+    for (uint32_t i = 0;  i < count;  i++)
+        supported[i] = GLFW_TRUE;
+
     return GLFW_TRUE;
 }
 
@@ -340,6 +340,376 @@ const _GLFWfbconfig* _glfwChooseFBConfig(const _GLFWfbconfig* desired,
     return closest;
 }
 
+// Allocates a framebuffer config cache for the specified number of configs
+//
+_GLFWfbconfigcache* _glfwCreateFBConfigCache(int count)
+{
+    _GLFWfbconfigcache* cache = _glfw_calloc(1, sizeof(_GLFWfbconfigcache));
+    if (!cache)
+    {
+        _glfwInputError(GLFW_OUT_OF_MEMORY, NULL);
+        return NULL;
+    }
+
+    cache->configs = _glfw_calloc(count, sizeof(_GLFWfbconfig));
+    cache->apis = _glfw_calloc(count, sizeof(int));
+    if (!cache->configs || !cache->apis)
+    {
+        _glfwInputError(GLFW_OUT_OF_MEMORY, NULL);
+        _glfwFreeFBConfigCache(cache);
+        return NULL;
+    }
+
+    return cache;
+}
+
+// Frees a framebuffer config cache
+//
+void _glfwFreeFBConfigCache(_GLFWfbconfigcache* cache)
+{
+    if (!cache)
+        return;
+
+    _glfw_free(cache->configs);
+    _glfw_free(cache->apis);
+    _glfw_free(cache->choices);
+    _glfw_free(cache);
+}
+
+// Returns the config previously chosen for the specified hints, if any
+//
+GLFWbool _glfwFindChosenFBConfig(const _GLFWfbconfigcache* cache,
+                                 const _GLFWfbconfig* desired,
+                                 int key, uintptr_t* handle)
+{
+    for (int i = 0;  i < cache->choiceCount;  i++)
+    {
+        const _GLFWfbconfigchoice* choice = cache->choices + i;
+
+        // The config structure has no padding, as all its members are ints
+        // except the trailing handle
+        if (choice->key == key &&
+            memcmp(&choice->desired, desired, offsetof(_GLFWfbconfig, handle)) == 0)
+        {
+            *handle = choice->handle;
+            return GLFW_TRUE;
+        }
+    }
+
+    return GLFW_FALSE;
+}
+
+// Remembers the config chosen for the specified hints
+//
+void _glfwAddChosenFBConfig(_GLFWfbconfigcache* cache,
+                            const _GLFWfbconfig* desired,
+                            int key, uintptr_t handle)
+{
+    _GLFWfbconfigchoice* choices =
+        _glfw_realloc(cache->choices,
+                      (cache->choiceCount + 1) * sizeof(_GLFWfbconfigchoice));
+    if (!choices)
+        return;
+
+    cache->choices = choices;
+    cache->choices[cache->choiceCount].desired = *desired;
+    cache->choices[cache->choiceCount].key = key;
+    cache->choices[cache->choiceCount].handle = handle;
+    cache->choiceCount++;
+}
+
+// Returns the FNV-1a hash of the specified entry point or extension name
+//
+static uint32_t hashName(const char* name)
+{
+    uint32_t hash = 2166136261u;
+
+    while (*name)
+    {
+        hash ^= (unsigned char) *name++;
+        hash *= 16777619u;
+    }
+
+    return hash;
+}
+
+// Returns the slot holding the specified name or the empty slot where it would
+// be inserted
+//
+static _GLFWprocentry* findProcEntry(_GLFWproccache* cache,
+                                     const char* name, uint32_t hash)
+{
+    const unsigned int mask = cache->size - 1;
+    unsigned int index = hash & mask;
+
+    for (;;)
+    {
+        _GLFWprocentry* entry = cache->entries + index;
+        if (!entry->name)
+            return entry;
+        if (entry->hash == hash && strcmp(entry->name, name) == 0)
+            return entry;
+
+        index = (index + 1) & mask;
+    }
+}
+
+// Doubles the size of the cache, keeping it at most half full
+//
+static GLFWbool growProcCache(_GLFWproccache* cache)
+{
+    _GLFWproccache grown = *cache;
+    grown.size = cache->size ? cache->size * 2 : 1024;
+    grown.entries = _glfw_calloc(grown.size, sizeof(_GLFWprocentry));
+    if (!grown.entries)
+        return GLFW_FALSE;
+
+    for (unsigned int i = 0;  i < cache->size;  i++)
+    {
+        const _GLFWprocentry* entry = cache->entries + i;
+        if (entry->name)
+            *findProcEntry(&grown, entry->name, entry->hash) = *entry;
+    }
+
+    _glfw_free(cache->entries);
+    cache->entries = grown.entries;
+    cache->size = grown.size;
+    return GLFW_TRUE;
+}
+
+// Returns the address of the specified entry point, resolving it only if it
+// has not been resolved before in the share group
+// The cache mutex must be held by the caller
+//
+static GLFWglproc getCachedProcAddress(_GLFWwindow* window, const char* procname)
+{
+    _GLFWproccache* cache = window->context.procCache;
+    if (!cache)
+        return window->context.getProcAddress(procname);
+
+    if ((cache->count + 1) * 2 > cache->size)
+    {
+        if (!growProcCache(cache))
+            return window->context.getProcAddress(procname);
+    }
+
+    const uint32_t hash = hashName(procname);
+    _GLFWprocentry* entry = findProcEntry(cache, procname, hash);
+    if (!entry->name)
+    {
+        // Entry points that are not found are cached as well, as loaders query
+        // many names that the implementation does not provide
+        entry->name = _glfw_strdup(procname);
+        if (!entry->name)
+            return window->context.getProcAddress(procname);
+
+        entry->hash = hash;
+        entry->proc = window->context.getProcAddress(procname);
+        cache->count++;
+    }
+
+    return entry->proc;
+}
+
+// Makes the context use the entry point cache of its share group, creating it
+// if necessary
+//
+static GLFWbool acquireProcCache(_GLFWwindow* window, _GLFWwindow* share)
+{
+    // WGL entry point addresses may differ between contexts even if they share
+    // objects, so only share the cache between contexts of the same API where
+    // addresses depend only on the name
+    if (share && share->context.procCache &&
+        share->context.getProcAddress == window->context.getProcAddress &&
+        !(_glfw.platform.platformID == GLFW_PLATFORM_WIN32 &&
+          window->context.source == GLFW_NATIVE_CONTEXT_API))
+    {
+        window->context.procCache = share->context.procCache;
+        window->context.procCache->refs++;
+        return GLFW_TRUE;
+    }
+
+    _GLFWproccache* cache = _glfw_calloc(1, sizeof(_GLFWproccache));
+    if (!cache)
+    {
+        _glfwInputError(GLFW_OUT_OF_MEMORY, NULL);
+        return GLFW_FALSE;
+    }
+
+    if (!_glfwPlatformCreateMutex(&cache->mutex))
+    {
+        _glfw_free(cache);
+        return GLFW_FALSE;
+    }
+
+    cache->refs = 1;
+    window->context.procCache = cache;
+    return GLFW_TRUE;
+}
+
+// Returns the slot holding the specified extension or the empty slot where it
+// would be inserted
+//
+static _GLFWextension* findExtension(_GLFWwindow* window,
+                                     const char* name, uint32_t hash)
+{
+    const unsigned int mask = window->context.extensions.size - 1;
+    unsigned int index = hash & mask;
+
+    for (;;)
+    {
+        _GLFWextension* entry = window->context.extensions.entries + index;
+        if (!entry->name)
+            return entry;
+        if (entry->hash == hash && strcmp(entry->name, name) == 0)
+            return entry;
+
+        index = (index + 1) & mask;
+    }
+}
+
+// Adds the specified extension to the set of the context, keeping the set at
+// most half full
+//
+static GLFWbool addExtension(_GLFWwindow* window, const char* name,
+                             size_t length, GLFWbool supported)
+{
+    if ((window->context.extensions.count + 1) * 2 > window->context.extensions.size)
+    {
+        const _GLFWextension* entries = window->context.extensions.entries;
+        const unsigned int size = window->context.extensions.size;
+
+        window->context.extensions.size = size ? size * 2 : 512;
+        window->context.extensions.entries =
+            _glfw_calloc(window->context.extensions.size, sizeof(_GLFWextension));
+        if (!window->context.extensions.entries)
+        {
+            window->context.extensions.entries = (_GLFWextension*) entries;
+            window->context.extensions.size = size;
+            _glfwInputError(GLFW_OUT_OF_MEMORY, NULL);
+            return GLFW_FALSE;
+        }
+
+        for (unsigned int i = 0;  i < size;  i++)
+        {
+            if (entries[i].name)
+                *findExtension(window, entries[i].name, entries[i].hash) = entries[i];
+        }
+
+        _glfw_free((void*) entries);
+    }
+
+    char* copy = _glfw_calloc(length + 1, 1);
+    if (!copy)
+    {
+        _glfwInputError(GLFW_OUT_OF_MEMORY, NULL);
+        return GLFW_FALSE;
+    }
+
+    memcpy(copy, name, length);
+
+    const uint32_t hash = hashName(copy);
+    _GLFWextension* entry = findExtension(window, copy, hash);
+    if (entry->name)
+    {
+        // Some drivers list an extension more than once
+        _glfw_free(copy);
+        return GLFW_TRUE;
+    }
+
+    entry->name = copy;
+    entry->hash = hash;
+    entry->supported = supported;
+    window->context.extensions.count++;
+    return GLFW_TRUE;
+}
+
+// Builds the extension set of the current context from its client API
+// extension list
+//
+static GLFWbool loadContextExtensions(_GLFWwindow* window)
+{
+    if (window->context.major >= 3)
+    {
+        GLint count;
+        window->context.GetIntegerv(GL_NUM_EXTENSIONS, &count);
+
+        for (GLint i = 0;  i < count;  i++)
+        {
+            const char* name = (const char*)
+                window->context.GetStringi(GL_EXTENSIONS, i);
+            if (!name)
+            {
+                _glfwInputError(GLFW_PLATFORM_ERROR,
+                                "Extension string retrieval is broken");
+                return GLFW_FALSE;
+            }
+
+            if (!addExtension(window, name, strlen(name), GLFW_TRUE))
+                return GLFW_FALSE;
+        }
+    }
+    else
+    {
+        const char* extensions = (const char*)
+            window->context.GetString(GL_EXTENSIONS);
+        if (!extensions)
+        {
+            _glfwInputError(GLFW_PLATFORM_ERROR,
+                            "Extension string retrieval is broken");
+            return GLFW_FALSE;
+        }
+
+        while (*extensions)
+        {
+            const size_t length = strcspn(extensions, " ");
+            if (length)
+            {
+                if (!addExtension(window, extensions, length, GLFW_TRUE))
+                    return GLFW_FALSE;
+            }
+
+            extensions += length;
+            extensions += strspn(extensions, " ");
+        }
+    }
+
+    return GLFW_TRUE;
+}
+
+// Releases the entry point cache of the context, destroying it if no other
+// context in the share group uses it
+//
+void _glfwReleaseProcCache(_GLFWwindow* window)
+{
+    _GLFWproccache* cache = window->context.procCache;
+    if (!cache)
+        return;
+
+    window->context.procCache = NULL;
+
+    if (--cache->refs)
+        return;
+
+    for (unsigned int i = 0;  i < cache->size;  i++)
+        _glfw_free(cache->entries[i].name);
+
+    _glfw_free(cache->entries);
+    _glfwPlatformDestroyMutex(&cache->mutex);
+    _glfw_free(cache);
+}
+
+// Frees the extension set of the context
+//
+void _glfwFreeContextExtensions(_GLFWwindow* window)
+{
+    for (unsigned int i = 0;  i < window->context.extensions.size;  i++)
+        _glfw_free(window->context.extensions.entries[i].name);
+
+    _glfw_free(window->context.extensions.entries);
+    memset(&window->context.extensions, 0, sizeof(window->context.extensions));
+}
+
 // Retrieves the attributes of the current context
 //
 GLFWbool _glfwRefreshContextAttribs(_GLFWwindow* window,
@@ -472,6 +842,14 @@ GLFWbool _glfwRefreshContextAttribs(_GLFWwindow* window,
         }
     }
 
+    // The extension list cannot change for the lifetime of the context, so it
+    // is captured once instead of being searched by every query
+    if (!loadContextExtensions(window))
+    {
+        glfwMakeContextCurrent((GLFWwindow*) previous);
+        return GLFW_FALSE;
+    }
+
     if (window->context.client == GLFW_OPENGL_API)
     {
         // Read back context flags (OpenGL 3.0 and above)
@@ -567,6 +945,7 @@ GLFWbool _glfwRefreshContextAttribs(_GLFWwindow* window,
 
     // Clearing the front buffer to black to avoid garbage pixels left over from
     // previous uses of our bit of VRAM
+    if (!window->contextOnly)
     {
         PFNGLCLEARPROC glClear = (PFNGLCLEARPROC)
             window->context.getProcAddress("glClear");
@@ -577,7 +956,7 @@ GLFWbool _glfwRefreshContextAttribs(_GLFWwindow* window,
     }
 
     glfwMakeContextCurrent((GLFWwindow*) previous);
-    return GLFW_TRUE;
+    return acquireProcCache(window, ctxconfig->share);
 }
 
 // Searches an extension string for the specified extension
@@ -608,20 +987,209 @@ GLFWbool _glfwStringInExtensionString(const char* string, const char* extensions
     return GLFW_TRUE;
 }
 
+// Returns the swap histogram bucket for the specified time in seconds
+//
+static int getSwapHistogramBucket(double seconds)
+{
+    double micros = seconds * 1000000.0;
+    int bucket = 0;
+
+    // The time is kept as a double, as converting it to microseconds in timer
+    // units would overflow for long intervals
+    while (micros >= 2.0 && bucket < GLFW_SWAP_HISTOGRAM_SIZE - 1)
+    {
+        micros /= 2.0;
+        bucket++;
+    }
+
+    return bucket;
+}
+
+// Adds a buffer swap between the specified timer values to the statistics
+//
+static void recordSwap(_GLFWwindow* window, uint64_t start, uint64_t end)
+{
+    GLFWswapstats* stats = &window->swapStats;
+    const uint64_t frequency = _glfwPlatformGetTimerFrequency();
+    const uint64_t duration = end - start;
+    const double seconds = (double) duration / frequency;
+
+    stats->swaps++;
+    stats->swapTime += seconds;
+    if (seconds > stats->maxSwapTime)
+        stats->maxSwapTime = seconds;
+    stats->swapTimes[getSwapHistogramBucket(seconds)]++;
+
+    if (window->lastSwap)
+    {
+        const uint64_t interval = end - window->lastSwap;
+        const double intervalSeconds = (double) interval / frequency;
+
+        if (intervalSeconds > stats->maxInterval)
+            stats->maxInterval = intervalSeconds;
+        stats->intervals[getSwapHistogramBucket(intervalSeconds)]++;
+
+        // A frame that took more than one and a half refresh periods missed
+        // at least one refresh
+        if (interval * 2 > window->swapPeriod * 3)
+            stats->missedDeadlines++;
+    }
+
+    window->lastSwap = end;
+}
+
+// Swaps the buffers of the window, passing on any damage rectangles if the
+// context creation API supports them
+//
+void _glfwPresentBuffers(_GLFWwindow* window, const int* rects, int count)
+{
+    uint64_t start = 0;
+
+    if (window->swapStatistics)
+        start = _glfwPlatformGetTimerValue();
+
+    if (count && window->context.swapBuffersWithDamage)
+        window->context.swapBuffersWithDamage(window, rects, count);
+    else
+        window->context.swapBuffers(window);
+
+    if (window->swapStatistics)
+        recordSwap(window, start, _glfwPlatformGetTimerValue());
+}
+
+// Returns whether making the context current resizes its default framebuffer
+// to the window framebuffer, as OSMesa does with its buffer and EGL with the
+// pbuffer it uses on the Null platform
+//
+static GLFWbool resizesOnMakeCurrent(const _GLFWwindow* window)
+{
+    if (window->context.source == GLFW_OSMESA_CONTEXT_API)
+        return GLFW_TRUE;
+
+    if (window->context.source == GLFW_EGL_CONTEXT_API &&
+        _glfw.platform.platformID == GLFW_PLATFORM_NULL &&
+        !window->contextOnly)
+    {
+        return GLFW_TRUE;
+    }
+
+    return GLFW_FALSE;
+}
+
+// Swaps the buffers of the window, or queues the swap on its present thread
+//
+static void swapWindowBuffers(_GLFWwindow* window, const int* rects, int count)
+{
+    // A context without a window has no buffers to swap
+    if (window->contextOnly)
+        return;
+
+    if (window->capture)
+        _glfwCaptureFrame(window);
+
+    if (window->present)
+        _glfwQueuePresent(window, rects, count);
+    else
+        _glfwPresentBuffers(window, rects, count);
+}
+
 
 //////////////////////////////////////////////////////////////////////////
 //////                        GLFW public API                       //////
 //////////////////////////////////////////////////////////////////////////
 
+GLFWAPI int glfwCreateSharedContexts(GLFWwindow* handle, int count,
+                                     GLFWwindow** contexts)
+{
+    _GLFWctxconfig ctxconfig;
+    _GLFWfbconfig fbconfig;
+
+    assert(contexts != NULL);
+
+    _GLFW_REQUIRE_INIT_OR_RETURN(GLFW_FALSE);
+
+    _GLFWwindow* share = (_GLFWwindow*) handle;
+    assert(share != NULL);
+
+    if (count < 0)
+    {
+        _glfwInputError(GLFW_INVALID_VALUE, "Invalid context count %i", count);
+        return GLFW_FALSE;
+    }
+
+    if (share->context.client == GLFW_NO_API)
+    {
+        _glfwInputError(GLFW_NO_WINDOW_CONTEXT,
+                        "Cannot share with a window that has no OpenGL or OpenGL ES context");
+        return GLFW_FALSE;
+    }
+
+    // Request the same kind of context as the one being shared with, using the
+    // attributes read back from it
+    memset(&ctxconfig, 0, sizeof(ctxconfig));
+    ctxconfig.client     = share->context.client;
+    ctxconfig.source     = share->context.source;
+    ctxconfig.major      = share->context.major;
+    ctxconfig.minor      = share->context.minor;
+    ctxconfig.forward    = share->context.forward;
+    ctxconfig.debug      = share->context.debug;
+    ctxconfig.noerror    = share->context.noerror;
+    ctxconfig.profile    = share->context.profile;
+    ctxconfig.robustness = share->context.robustness;
+    ctxconfig.release    = share->context.release;
+    ctxconfig.share      = share;
+
+    // These contexts have no default framebuffer
+    memset(&fbconfig, 0, sizeof(fbconfig));
+
+    for (int i = 0;  i < count;  i++)
+    {
+        _GLFWwindow* window = _glfw_calloc(1, sizeof(_GLFWwindow));
+        if (window)
+        {
+            window->next = _glfw.contextListHead;
+            _glfw.contextListHead = window;
+
+            window->contextOnly = GLFW_TRUE;
+        }
+        else
+            _glfwInputError(GLFW_OUT_OF_MEMORY, NULL);
+
+        contexts[i] = (GLFWwindow*) window;
+
+        if (!window ||
+            !_glfw.platform.createSharedContext(window, &ctxconfig, &fbconfig) ||
+            !_glfwRefreshContextAttribs(window, &ctxconfig))
+        {
+            for (int j = 0;  j <= i;  j++)
+            {
+                glfwDestroyWindow(contexts[j]);
+                contexts[j] = NULL;
+            }
+
+            return GLFW_FALSE;
+        }
+    }
+
+    return GLFW_TRUE;
+}
+
 GLFWAPI void glfwMakeContextCurrent(GLFWwindow* handle)
 {
     _GLFW_REQUIRE_INIT();
 
     _GLFWwindow* window = (_GLFWwindow*) handle;
     _GLFWwindow* previous;
+    _GLFWwindow* lazy;
 
     previous = _glfwPlatformGetTls(&_glfw.contextSlot);
 
+    // There is no need to involve the context creation API if the context is
+    // already current on this thread, unless making it current resizes its
+    // default framebuffer
+    if (window && window == previous && !resizesOnMakeCurrent(window))
+        return;
+
     if (window && window->context.client == GLFW_NO_API)
     {
         _glfwInputError(GLFW_NO_WINDOW_CONTEXT,
@@ -629,14 +1197,48 @@ GLFWAPI void glfwMakeContextCurrent(GLFWwindow* handle)
         return;
     }
 
+    // The context is owned by the present thread until the queued buffer swap
+    // has completed
+    if (window && window->present)
+        _glfwWaitForPresent(window);
+
+    lazy = _glfwPlatformGetTls(&_glfw.lazyContextSlot);
+    if (lazy)
+    {
+        // The context whose release was deferred is still current in the
+        // context creation API and is either made current again or released
+        _glfwPlatformSetTls(&_glfw.lazyContextSlot, NULL);
+
+        if (window == lazy && !resizesOnMakeCurrent(window))
+        {
+            _glfwPlatformSetTls(&_glfw.contextSlot, window);
+            return;
+        }
+
+        previous = lazy;
+    }
+    else if (!window && previous && _glfw.hints.init.lazyContextRelease)
+    {
+        // Defer the release until another context is made current
+        _glfwPlatformSetTls(&_glfw.lazyContextSlot, previous);
+        _glfwPlatformSetTls(&_glfw.contextSlot, NULL);
+        return;
+    }
+
     if (previous)
     {
         if (!window || window->context.source != previous->context.source)
+        {
             previous->context.makeCurrent(NULL);
+            _glfwCountMakeCurrent();
+        }
     }
 
     if (window)
+    {
         window->context.makeCurrent(window);
+        _glfwCountMakeCurrent();
+    }
 }
 
 GLFWAPI GLFWwindow* glfwGetCurrentContext(void)
@@ -659,7 +1261,33 @@ GLFWAPI void glfwSwapBuffers(GLFWwindow* handle)
         return;
     }
 
-    window->context.swapBuffers(window);
+    swapWindowBuffers(window, NULL, 0);
+}
+
+GLFWAPI void glfwSwapBuffersWithDamage(GLFWwindow* handle,
+                                       const int* rects, int count)
+{
+    _GLFW_REQUIRE_INIT();
+
+    _GLFWwindow* window = (_GLFWwindow*) handle;
+    assert(window != NULL);
+    assert(count >= 0);
+    assert(rects != NULL || count == 0);
+
+    if (window->context.client == GLFW_NO_API)
+    {
+        _glfwInputError(GLFW_NO_WINDOW_CONTEXT,
+                        "Cannot swap buffers of a window that has no OpenGL or OpenGL ES context");
+        return;
+    }
+
+    if (count < 0 || (count > 0 && !rects))
+    {
+        _glfwInputError(GLFW_INVALID_VALUE, "Invalid damage rectangle count %i", count);
+        return;
+    }
+
+    swapWindowBuffers(window, rects, count);
 }
 
 GLFWAPI void glfwSwapInterval(int interval)
@@ -676,6 +1304,9 @@ GLFWAPI void glfwSwapInterval(int interval)
         return;
     }
 
+    if (window->contextOnly)
+        return;
+
     window->context.swapInterval(interval);
 }
 
@@ -700,66 +1331,87 @@ GLFWAPI int glfwExtensionSupported(const char* extension)
         return GLFW_FALSE;
     }
 
-    if (window->context.major >= 3)
+    if (window->context.extensions.size)
     {
-        int i;
-        GLint count;
+        const uint32_t hash = hashName(extension);
+        const _GLFWextension* entry = findExtension(window, extension, hash);
+        if (entry->name)
+            return entry->supported;
+    }
 
-        // Check if extension is in the modern OpenGL extensions string list
+    // Check if extension is in the platform-specific string and remember the
+    // answer, as that string cannot change either
+    const GLFWbool supported = window->context.extensionSupported(extension);
+    addExtension(window, extension, strlen(extension), supported);
+    return supported;
+}
 
-        window->context.GetIntegerv(GL_NUM_EXTENSIONS, &count);
+GLFWAPI GLFWglproc glfwGetProcAddress(const char* procname)
+{
+    _GLFWwindow* window;
+    assert(procname != NULL);
 
-        for (i = 0;  i < count;  i++)
-        {
-            const char* en = (const char*)
-                window->context.GetStringi(GL_EXTENSIONS, i);
-            if (!en)
-            {
-                _glfwInputError(GLFW_PLATFORM_ERROR,
-                                "Extension string retrieval is broken");
-                return GLFW_FALSE;
-            }
+    _GLFW_REQUIRE_INIT_OR_RETURN(NULL);
 
-            if (strcmp(en, extension) == 0)
-                return GLFW_TRUE;
-        }
-    }
-    else
+    window = _glfwPlatformGetTls(&_glfw.contextSlot);
+    if (!window)
     {
-        // Check if extension is in the old style OpenGL extensions string
+        _glfwInputError(GLFW_NO_CURRENT_CONTEXT,
+                        "Cannot query entry point without a current OpenGL or OpenGL ES context");
+        return NULL;
+    }
 
-        const char* extensions = (const char*)
-            window->context.GetString(GL_EXTENSIONS);
-        if (!extensions)
-        {
-            _glfwInputError(GLFW_PLATFORM_ERROR,
-                            "Extension string retrieval is broken");
-            return GLFW_FALSE;
-        }
+    _GLFWproccache* cache = window->context.procCache;
+    if (cache)
+        _glfwPlatformLockMutex(&cache->mutex);
 
-        if (_glfwStringInExtensionString(extension, extensions))
-            return GLFW_TRUE;
-    }
+    const GLFWglproc proc = getCachedProcAddress(window, procname);
 
-    // Check if extension is in the platform-specific string
-    return window->context.extensionSupported(extension);
+    if (cache)
+        _glfwPlatformUnlockMutex(&cache->mutex);
+
+    return proc;
 }
 
-GLFWAPI GLFWglproc glfwGetProcAddress(const char* procname)
+GLFWAPI int glfwGetProcAddresses(const char* const* procnames,
+                                 GLFWglproc* procs, int count)
 {
     _GLFWwindow* window;
-    assert(procname != NULL);
+    int found = 0;
 
-    _GLFW_REQUIRE_INIT_OR_RETURN(NULL);
+    assert(count >= 0);
+    assert(count == 0 || (procnames != NULL && procs != NULL));
+
+    _GLFW_REQUIRE_INIT_OR_RETURN(0);
+
+    if (count < 0)
+    {
+        _glfwInputError(GLFW_INVALID_VALUE, "Invalid entry point count %i", count);
+        return 0;
+    }
 
     window = _glfwPlatformGetTls(&_glfw.contextSlot);
     if (!window)
     {
         _glfwInputError(GLFW_NO_CURRENT_CONTEXT,
-                        "Cannot query entry point without a current OpenGL or OpenGL ES context");
-        return NULL;
+                        "Cannot query entry points without a current OpenGL or OpenGL ES context");
+        return 0;
     }
 
-    return window->context.getProcAddress(procname);
+    _GLFWproccache* cache = window->context.procCache;
+    if (cache)
+        _glfwPlatformLockMutex(&cache->mutex);
+
+    for (int i = 0;  i < count;  i++)
+    {
+        procs[i] = getCachedProcAddress(window, procnames[i]);
+        if (procs[i])
+            found++;
+    }
+
+    if (cache)
+        _glfwPlatformUnlockMutex(&cache->mutex);
+
+    return found;
 }
 
@@ -83,56 +83,40 @@ static int getEGLConfigAttrib(EGLConfig config, int attrib)
     return value;
 }
 
-// Return the EGLConfig most closely matching the specified hints
+// Enumerates and translates the usable EGLConfigs of the display
 //
-static GLFWbool chooseEGLConfig(const _GLFWctxconfig* ctxconfig,
-                                const _GLFWfbconfig* fbconfig,
-                                EGLConfig* result)
+static _GLFWfbconfigcache* createEGLConfigCache(void)
 {
     EGLConfig* nativeConfigs;
-    _GLFWfbconfig* usableConfigs;
-    const _GLFWfbconfig* closest;
-    int i, nativeCount, usableCount, apiBit, surfaceTypeBit;
-    GLFWbool wrongApiAvailable = GLFW_FALSE;
-
-    if (ctxconfig->client == GLFW_OPENGL_ES_API)
-    {
-        if (ctxconfig->major == 1)
-            apiBit = EGL_OPENGL_ES_BIT;
-        else
-            apiBit = EGL_OPENGL_ES2_BIT;
-    }
-    else
-        apiBit = EGL_OPENGL_BIT;
+    _GLFWfbconfigcache* cache;
+    int i, nativeCount, surfaceTypeBit;
 
-    if (_glfw.egl.platform == EGL_PLATFORM_SURFACELESS_MESA)
+    if (_glfw.platform.platformID == GLFW_PLATFORM_NULL)
         surfaceTypeBit = EGL_PBUFFER_BIT;
     else
         surfaceTypeBit = EGL_WINDOW_BIT;
 
-    if (fbconfig->stereo)
-    {
-        _glfwInputError(GLFW_FORMAT_UNAVAILABLE, "EGL: Stereo rendering not supported");
-        return GLFW_FALSE;
-    }
-
     eglGetConfigs(_glfw.egl.display, NULL, 0, &nativeCount);
     if (!nativeCount)
     {
         _glfwInputError(GLFW_API_UNAVAILABLE, "EGL: No EGLConfigs returned");
-        return GLFW_FALSE;
+        return NULL;
     }
 
     nativeConfigs = _glfw_calloc(nativeCount, sizeof(EGLConfig));
     eglGetConfigs(_glfw.egl.display, nativeConfigs, nativeCount, &nativeCount);
 
-    usableConfigs = _glfw_calloc(nativeCount, sizeof(_GLFWfbconfig));
-    usableCount = 0;
+    cache = _glfwCreateFBConfigCache(nativeCount);
+    if (!cache)
+    {
+        _glfw_free(nativeConfigs);
+        return NULL;
+    }
 
     for (i = 0;  i < nativeCount;  i++)
     {
         const EGLConfig n = nativeConfigs[i];
-        _GLFWfbconfig* u = usableConfigs + usableCount;
+        _GLFWfbconfig* u = cache->configs + cache->count;
 
         // Only consider RGB(A) EGLConfigs
         if (getEGLConfigAttrib(n, EGL_COLOR_BUFFER_TYPE) != EGL_RGB_BUFFER)
@@ -145,31 +129,24 @@ static GLFWbool chooseEGLConfig(const _GLFWctxconfig* ctxconfig,
         if (_glfw.platform.platformID == GLFW_PLATFORM_X11)
         {
             XVisualInfo vi = {0};
+            int count;
 
             // Only consider EGLConfigs with associated Visuals
             vi.visualid = getEGLConfigAttrib(n, EGL_NATIVE_VISUAL_ID);
             if (!vi.visualid)
                 continue;
 
-            if (fbconfig->transparent)
+            XVisualInfo* vis =
+                XGetVisualInfo(_glfw.x11.display, VisualIDMask, &vi, &count);
+            if (vis)
             {
-                int count;
-                XVisualInfo* vis =
-                    XGetVisualInfo(_glfw.x11.display, VisualIDMask, &vi, &count);
-                if (vis)
-                {
-                    u->transparent = _glfwIsVisualTransparentX11(vis[0].visual);
-                    XFree(vis);
-                }
+                u->transparent = _glfwIsVisualTransparentX11(vis[0].visual);
+                XFree(vis);
             }
         }
 #endif // _GLFW_X11
 
-        if (!(getEGLConfigAttrib(n, EGL_RENDERABLE_TYPE) & apiBit))
-        {
-            wrongApiAvailable = GLFW_TRUE;
-            continue;
-        }
+        cache->apis[cache->count] = getEGLConfigAttrib(n, EGL_RENDERABLE_TYPE);
 
         u->redBits = getEGLConfigAttrib(n, EGL_RED_SIZE);
         u->greenBits = getEGLConfigAttrib(n, EGL_GREEN_SIZE);
@@ -179,6 +156,71 @@ static GLFWbool chooseEGLConfig(const _GLFWctxconfig* ctxconfig,
         u->depthBits = getEGLConfigAttrib(n, EGL_DEPTH_SIZE);
         u->stencilBits = getEGLConfigAttrib(n, EGL_STENCIL_SIZE);
 
+        u->samples = getEGLConfigAttrib(n, EGL_SAMPLES);
+
+        u->handle = (uintptr_t) n;
+        cache->count++;
+    }
+
+    _glfw_free(nativeConfigs);
+    return cache;
+}
+
+// Return the EGLConfig most closely matching the specified hints
+//
+static GLFWbool chooseEGLConfig(const _GLFWctxconfig* ctxconfig,
+                                const _GLFWfbconfig* fbconfig,
+                                EGLConfig* result)
+{
+    _GLFWfbconfig* usableConfigs;
+    const _GLFWfbconfig* closest;
+    uintptr_t handle;
+    int i, usableCount, apiBit;
+    GLFWbool wrongApiAvailable = GLFW_FALSE;
+
+    if (ctxconfig->client == GLFW_OPENGL_ES_API)
+    {
+        if (ctxconfig->major == 1)
+            apiBit = EGL_OPENGL_ES_BIT;
+        else
+            apiBit = EGL_OPENGL_ES2_BIT;
+    }
+    else
+        apiBit = EGL_OPENGL_BIT;
+
+    if (fbconfig->stereo)
+    {
+        _glfwInputError(GLFW_FORMAT_UNAVAILABLE, "EGL: Stereo rendering not supported");
+        return GLFW_FALSE;
+    }
+
+    if (!_glfw.egl.fbconfigs)
+    {
+        _glfw.egl.fbconfigs = createEGLConfigCache();
+        if (!_glfw.egl.fbconfigs)
+            return GLFW_FALSE;
+    }
+
+    if (_glfwFindChosenFBConfig(_glfw.egl.fbconfigs, fbconfig, apiBit, &handle))
+    {
+        *result = (EGLConfig) handle;
+        return GLFW_TRUE;
+    }
+
+    usableConfigs = _glfw_calloc(_glfw.egl.fbconfigs->count, sizeof(_GLFWfbconfig));
+    usableCount = 0;
+
+    for (i = 0;  i < _glfw.egl.fbconfigs->count;  i++)
+    {
+        const _GLFWfbconfig* c = _glfw.egl.fbconfigs->configs + i;
+        _GLFWfbconfig* u = usableConfigs + usableCount;
+
+        if (!(_glfw.egl.fbconfigs->apis[i] & apiBit))
+        {
+            wrongApiAvailable = GLFW_TRUE;
+            continue;
+        }
+
 #if defined(_GLFW_WAYLAND)
         if (_glfw.platform.platformID == GLFW_PLATFORM_WAYLAND)
         {
@@ -188,22 +230,28 @@ static GLFWbool chooseEGLConfig(const _GLFWctxconfig* ctxconfig,
             //       with an alpha channel to ensure the buffer is opaque
             if (!_glfw.egl.EXT_present_opaque)
             {
-                if (!fbconfig->transparent && u->alphaBits > 0)
+                if (!fbconfig->transparent && c->alphaBits > 0)
                     continue;
             }
         }
 #endif // _GLFW_WAYLAND
 
-        u->samples = getEGLConfigAttrib(n, EGL_SAMPLES);
-        u->doublebuffer = fbconfig->doublebuffer;
+        *u = *c;
 
-        u->handle = (uintptr_t) n;
+        // Transparency is only considered when it was requested
+        if (!fbconfig->transparent)
+            u->transparent = GLFW_FALSE;
+
+        u->doublebuffer = fbconfig->doublebuffer;
         usableCount++;
     }
 
     closest = _glfwChooseFBConfig(fbconfig, usableConfigs, usableCount);
     if (closest)
+    {
         *result = (EGLConfig) closest->handle;
+        _glfwAddChosenFBConfig(_glfw.egl.fbconfigs, fbconfig, apiBit, closest->handle);
+    }
     else
     {
         if (wrongApiAvailable)
@@ -234,16 +282,86 @@ static GLFWbool chooseEGLConfig(const _GLFWctxconfig* ctxconfig,
         }
     }
 
-    _glfw_free(nativeConfigs);
     _glfw_free(usableConfigs);
 
     return closest != NULL;
 }
 
+// Creates a pbuffer surface of the specified size to be used as the default
+// framebuffer of a window on the Null platform
+//
+static EGLSurface createPbufferSurfaceEGL(_GLFWwindow* window,
+                                          int width, int height)
+{
+    EGLint attribs[7];
+    int index = 0;
+    EGLSurface surface;
+
+    if (window->context.egl.sRGB)
+    {
+        attribs[index++] = EGL_GL_COLORSPACE_KHR;
+        attribs[index++] = EGL_GL_COLORSPACE_SRGB_KHR;
+    }
+
+    attribs[index++] = EGL_WIDTH;
+    attribs[index++] = width;
+    attribs[index++] = EGL_HEIGHT;
+    attribs[index++] = height;
+    attribs[index++] = EGL_NONE;
+
+    surface = eglCreatePbufferSurface(_glfw.egl.display,
+                                      window->context.egl.config,
+                                      attribs);
+    if (surface != EGL_NO_SURFACE)
+    {
+        window->context.egl.width = width;
+        window->context.egl.height = height;
+    }
+
+    return surface;
+}
+
+// Replaces the pbuffer used as the default framebuffer on the Null platform if
+// the framebuffer of the window has been resized since it was created
+//
+static void updatePbufferSizeEGL(_GLFWwindow* window, GLFWbool current)
+{
+    int width, height;
+    EGLSurface surface;
+
+    if (_glfw.platform.platformID != GLFW_PLATFORM_NULL || window->contextOnly)
+        return;
+
+    _glfw.platform.getFramebufferSize(window, &width, &height);
+    if (width == window->context.egl.width && height == window->context.egl.height)
+        return;
+
+    surface = createPbufferSurfaceEGL(window, width, height);
+    if (surface == EGL_NO_SURFACE)
+    {
+        _glfwInputError(GLFW_PLATFORM_ERROR,
+                        "EGL: Failed to resize pbuffer surface: %s",
+                        getEGLErrorString(eglGetError()));
+        return;
+    }
+
+    if (current)
+    {
+        eglMakeCurrent(_glfw.egl.display,
+                       surface, surface,
+                       window->context.egl.handle);
+    }
+
+    eglDestroySurface(_glfw.egl.display, window->context.egl.surface);
+    window->context.egl.surface = surface;
+}
+
 static void makeContextCurrentEGL(_GLFWwindow* window)
 {
     if (window)
     {
+        updatePbufferSizeEGL(window, GLFW_FALSE);
+
         if (!eglMakeCurrent(_glfw.egl.display,
                             window->context.egl.surface,
                             window->context.egl.surface,
@@ -272,7 +390,8 @@ static void makeContextCurrentEGL(_GLFWwindow* window)
     _glfwPlatformSetTls(&_glfw.contextSlot, window);
 }
 
-static void swapBuffersEGL(_GLFWwindow* window)
+static void swapBuffersWithDamageEGL(_GLFWwindow* window,
+                                     const int* rects, int count)
 {
     if (window != _glfwPlatformGetTls(&_glfw.contextSlot))
     {
@@ -287,10 +406,28 @@ static void swapBuffersEGL(_GLFWwindow* window)
         // NOTE: Swapping buffers on a hidden window on Wayland makes it visible
         if (!window->wl.visible)
             return;
+
+        if (window->callbacks.swapComplete && _glfw.wl.presentation)
+            _glfwRequestPresentationFeedbackWayland(window);
     }
 #endif
 
-    eglSwapBuffers(_glfw.egl.display, window->context.egl.surface);
+    if (count && eglSwapBuffersWithDamageKHR)
+    {
+        eglSwapBuffersWithDamageKHR(_glfw.egl.display,
+                                    window->context.egl.surface,
+                                    rects, count);
+    }
+    else
+        eglSwapBuffers(_glfw.egl.display, window->context.egl.surface);
+
+    // The next frame is rendered at the new size if the window was resized
+    updatePbufferSizeEGL(window, GLFW_TRUE);
+}
+
+static void swapBuffersEGL(_GLFWwindow* window)
+{
+    swapBuffersWithDamageEGL(window, NULL, 0);
 }
 
 static void swapIntervalEGL(int interval)
@@ -541,6 +678,24 @@ GLFWbool _glfwInitEGL(void)
         extensionSupportedEGL("EGL_KHR_context_flush_control");
     _glfw.egl.EXT_present_opaque =
         extensionSupportedEGL("EGL_EXT_present_opaque");
+    _glfw.egl.KHR_surfaceless_context =
+        extensionSupportedEGL("EGL_KHR_surfaceless_context");
+    _glfw.egl.KHR_swap_buffers_with_damage =
+        extensionSupportedEGL("EGL_KHR_swap_buffers_with_damage");
+    _glfw.egl.EXT_swap_buffers_with_damage =
+        extensionSupportedEGL("EGL_EXT_swap_buffers_with_damage");
+
+    // NOTE: The KHR and EXT versions of this function have the same signature
+    if (_glfw.egl.KHR_swap_buffers_with_damage)
+    {
+        _glfw.egl.SwapBuffersWithDamageKHR = (PFNEGLSWAPBUFFERSWITHDAMAGEKHRPROC)
+            eglGetProcAddress("eglSwapBuffersWithDamageKHR");
+    }
+    else if (_glfw.egl.EXT_swap_buffers_with_damage)
+    {
+        _glfw.egl.SwapBuffersWithDamageKHR = (PFNEGLSWAPBUFFERSWITHDAMAGEKHRPROC)
+            eglGetProcAddress("eglSwapBuffersWithDamageEXT");
+    }
 
     return GLFW_TRUE;
 }
@@ -549,6 +704,9 @@ GLFWbool _glfwInitEGL(void)
 //
 void _glfwTerminateEGL(void)
 {
+    _glfwFreeFBConfigCache(_glfw.egl.fbconfigs);
+    _glfw.egl.fbconfigs = NULL;
+
     if (_glfw.egl.display)
     {
         eglTerminate(_glfw.egl.display);
@@ -590,7 +748,11 @@ GLFWbool _glfwCreateContextEGL(_GLFWwindow* window,
     if (ctxconfig->share)
         share = ctxconfig->share->context.egl.handle;
 
-    if (!chooseEGLConfig(ctxconfig, fbconfig, &config))
+    // NOTE: A context without a window uses the EGLConfig of the context it
+    //       shares with, to ensure they are compatible
+    if (window->contextOnly)
+        config = ctxconfig->share->context.egl.config;
+    else if (!chooseEGLConfig(ctxconfig, fbconfig, &config))
         return GLFW_FALSE;
 
     if (ctxconfig->client == GLFW_OPENGL_ES_API)
@@ -699,62 +861,85 @@ GLFWbool _glfwCreateContextEGL(_GLFWwindow* window,
         return GLFW_FALSE;
     }
 
-    // Set up attributes for surface creation
-    index = 0;
-
-    if (fbconfig->sRGB)
+    if (window->contextOnly)
     {
-        if (_glfw.egl.KHR_gl_colorspace)
-            SET_ATTRIB(EGL_GL_COLORSPACE_KHR, EGL_GL_COLORSPACE_SRGB_KHR);
-    }
-
-    if (!fbconfig->doublebuffer)
-        SET_ATTRIB(EGL_RENDER_BUFFER, EGL_SINGLE_BUFFER);
+        // NOTE: A context without a window only needs a surface if it cannot be
+        //       made current without one
+        if (!_glfw.egl.KHR_surfaceless_context)
+        {
+            const EGLint pbufferAttribs[] = { EGL_WIDTH, 1, EGL_HEIGHT, 1, EGL_NONE };
 
-    if (_glfw.platform.platformID == GLFW_PLATFORM_WAYLAND)
-    {
-        if (_glfw.egl.EXT_present_opaque)
-            SET_ATTRIB(EGL_PRESENT_OPAQUE_EXT, !fbconfig->transparent);
+            window->context.egl.surface =
+                eglCreatePbufferSurface(_glfw.egl.display, config, pbufferAttribs);
+            if (window->context.egl.surface == EGL_NO_SURFACE)
+            {
+                _glfwInputError(GLFW_PLATFORM_ERROR,
+                                "EGL: Failed to create pbuffer surface: %s",
+                                getEGLErrorString(eglGetError()));
+                destroyContextEGL(window);
+                return GLFW_FALSE;
+            }
+        }
     }
-
-    if (_glfw.egl.platform == EGL_PLATFORM_SURFACELESS_MESA)
+    else
     {
-        int width, height;
-        _glfw.platform.getFramebufferSize(window, &width, &height);
+        // Set up attributes for surface creation
+        index = 0;
 
-        SET_ATTRIB(EGL_WIDTH, width);
-        SET_ATTRIB(EGL_HEIGHT, height);
-    }
+        if (fbconfig->sRGB)
+        {
+            if (_glfw.egl.KHR_gl_colorspace)
+                SET_ATTRIB(EGL_GL_COLORSPACE_KHR, EGL_GL_COLORSPACE_SRGB_KHR);
+        }
 
-    SET_ATTRIB(EGL_NONE, EGL_NONE);
+        if (!fbconfig->doublebuffer)
+            SET_ATTRIB(EGL_RENDER_BUFFER, EGL_SINGLE_BUFFER);
 
-    native = _glfw.platform.getEGLNativeWindow(window);
-    if (!_glfw.egl.platform || _glfw.egl.platform == EGL_PLATFORM_ANGLE_ANGLE)
-    {
-        // HACK: Also use non-platform function for ANGLE, as it does not
-        //       implement eglCreatePlatformWindowSurfaceEXT despite reporting
-        //       support for EGL_EXT_platform_base
-        window->context.egl.surface =
-            eglCreateWindowSurface(_glfw.egl.display, config, native, attribs);
-    }
-    else if (_glfw.egl.platform == EGL_PLATFORM_SURFACELESS_MESA)
-    {
-        // HACK: Use a pbuffer surface as the default framebuffer
-        window->context.egl.surface =
-            eglCreatePbufferSurface(_glfw.egl.display, config, attribs);
-    }
-    else
-    {
-        window->context.egl.surface =
-            eglCreatePlatformWindowSurfaceEXT(_glfw.egl.display, config, native, attribs);
-    }
+        if (_glfw.platform.platformID == GLFW_PLATFORM_WAYLAND)
+        {
+            if (_glfw.egl.EXT_present_opaque)
+                SET_ATTRIB(EGL_PRESENT_OPAQUE_EXT, !fbconfig->transparent);
+        }
 
-    if (window->context.egl.surface == EGL_NO_SURFACE)
-    {
-        _glfwInputError(GLFW_PLATFORM_ERROR,
-                        "EGL: Failed to create window surface: %s",
-                        getEGLErrorString(eglGetError()));
-        return GLFW_FALSE;
+        SET_ATTRIB(EGL_NONE, EGL_NONE);
+
+        if (_glfw.platform.platformID == GLFW_PLATFORM_NULL)
+        {
+            int width, height;
+            _glfw.platform.getFramebufferSize(window, &width, &height);
+
+            // HACK: Use a pbuffer surface as the default framebuffer, replaced
+            //       whenever the window framebuffer is resized
+            window->context.egl.config = config;
+            window->context.egl.sRGB = fbconfig->sRGB && _glfw.egl.KHR_gl_colorspace;
+            window->context.egl.surface =
+                createPbufferSurfaceEGL(window, width, height);
+        }
+        else
+        {
+            native = _glfw.platform.getEGLNativeWindow(window);
+            if (!_glfw.egl.platform || _glfw.egl.platform == EGL_PLATFORM_ANGLE_ANGLE)
+            {
+                // HACK: Also use non-platform function for ANGLE, as it does not
+                //       implement eglCreatePlatformWindowSurfaceEXT despite
+                //       reporting support for EGL_EXT_platform_base
+                window->context.egl.surface =
+                    eglCreateWindowSurface(_glfw.egl.display, config, native, attribs);
+            }
+            else
+            {
+                window->context.egl.surface =
+                    eglCreatePlatformWindowSurfaceEXT(_glfw.egl.display, config, native, attribs);
+            }
+        }
+
+        if (window->context.egl.surface == EGL_NO_SURFACE)
+        {
+            _glfwInputError(GLFW_PLATFORM_ERROR,
+                            "EGL: Failed to create window surface: %s",
+                            getEGLErrorString(eglGetError()));
+            return GLFW_FALSE;
+        }
     }
 
     window->context.egl.config = config;
@@ -840,12 +1025,19 @@ GLFWbool _glfwCreateContextEGL(_GLFWwindow* window,
         {
             _glfwInputError(GLFW_API_UNAVAILABLE,
                             "EGL: Failed to load client library");
+
+            // A context without a window is not destroyed by its platform if
+            // creation fails, so its handle must not outlive this call
+            if (window->contextOnly)
+                destroyContextEGL(window);
+
             return GLFW_FALSE;
         }
     }
 
     window->context.makeCurrent = makeContextCurrentEGL;
     window->context.swapBuffers = swapBuffersEGL;
+    window->context.swapBuffersWithDamage = swapBuffersWithDamageEGL;
     window->context.swapInterval = swapIntervalEGL;
     window->context.extensionSupported = extensionSupportedEGL;
     window->context.getProcAddress = getProcAddressEGL;
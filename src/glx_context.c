@@ -47,15 +47,13 @@ static int getGLXFBConfigAttrib(GLXFBConfig fbconfig, int attrib)
     return value;
 }
 
-// Return the GLXFBConfig most closely matching the specified hints
+// Enumerates and translates the usable GLXFBConfigs of the display
 //
-static GLFWbool chooseGLXFBConfig(const _GLFWfbconfig* desired,
-                                  GLXFBConfig* result)
+static _GLFWfbconfigcache* createGLXFBConfigCache(void)
 {
     GLXFBConfig* nativeConfigs;
-    _GLFWfbconfig* usableConfigs;
-    const _GLFWfbconfig* closest;
-    int nativeCount, usableCount;
+    _GLFWfbconfigcache* cache;
+    int nativeCount;
     const char* vendor;
     GLFWbool trustWindowBit = GLFW_TRUE;
 
@@ -70,16 +68,20 @@ static GLFWbool chooseGLXFBConfig(const _GLFWfbconfig* desired,
     if (!nativeConfigs || !nativeCount)
     {
         _glfwInputError(GLFW_API_UNAVAILABLE, "GLX: No GLXFBConfigs returned");
-        return GLFW_FALSE;
+        return NULL;
     }
 
-    usableConfigs = _glfw_calloc(nativeCount, sizeof(_GLFWfbconfig));
-    usableCount = 0;
+    cache = _glfwCreateFBConfigCache(nativeCount);
+    if (!cache)
+    {
+        XFree(nativeConfigs);
+        return NULL;
+    }
 
     for (int i = 0;  i < nativeCount;  i++)
     {
         const GLXFBConfig n = nativeConfigs[i];
-        _GLFWfbconfig* u = usableConfigs + usableCount;
+        _GLFWfbconfig* u = cache->configs + cache->count;
 
         // Only consider RGBA GLXFBConfigs
         if (!(getGLXFBConfigAttrib(n, GLX_RENDER_TYPE) & GLX_RGBA_BIT))
@@ -92,17 +94,11 @@ static GLFWbool chooseGLXFBConfig(const _GLFWfbconfig* desired,
                 continue;
         }
 
-        if (getGLXFBConfigAttrib(n, GLX_DOUBLEBUFFER) != desired->doublebuffer)
-            continue;
-
-        if (desired->transparent)
+        XVisualInfo* vi = glXGetVisualFromFBConfig(_glfw.x11.display, n);
+        if (vi)
         {
-            XVisualInfo* vi = glXGetVisualFromFBConfig(_glfw.x11.display, n);
-            if (vi)
-            {
-                u->transparent = _glfwIsVisualTransparentX11(vi->visual);
-                XFree(vi);
-            }
+            u->transparent = _glfwIsVisualTransparentX11(vi->visual);
+            XFree(vi);
         }
 
         u->redBits = getGLXFBConfigAttrib(n, GLX_RED_SIZE);
@@ -123,21 +119,74 @@ static GLFWbool chooseGLXFBConfig(const _GLFWfbconfig* desired,
         if (getGLXFBConfigAttrib(n, GLX_STEREO))
             u->stereo = GLFW_TRUE;
 
+        if (getGLXFBConfigAttrib(n, GLX_DOUBLEBUFFER))
+            u->doublebuffer = GLFW_TRUE;
+
         if (_glfw.glx.ARB_multisample)
             u->samples = getGLXFBConfigAttrib(n, GLX_SAMPLES);
 
         if (_glfw.glx.ARB_framebuffer_sRGB || _glfw.glx.EXT_framebuffer_sRGB)
             u->sRGB = getGLXFBConfigAttrib(n, GLX_FRAMEBUFFER_SRGB_CAPABLE_ARB);
 
+        // NOTE: GLXFBConfig handles remain valid after the array is freed
         u->handle = (uintptr_t) n;
+        cache->count++;
+    }
+
+    XFree(nativeConfigs);
+    return cache;
+}
+
+// Return the GLXFBConfig most closely matching the specified hints
+//
+static GLFWbool chooseGLXFBConfig(const _GLFWfbconfig* desired,
+                                  GLXFBConfig* result)
+{
+    _GLFWfbconfig* usableConfigs;
+    const _GLFWfbconfig* closest;
+    uintptr_t handle;
+    int usableCount;
+
+    if (!_glfw.glx.fbconfigs)
+    {
+        _glfw.glx.fbconfigs = createGLXFBConfigCache();
+        if (!_glfw.glx.fbconfigs)
+            return GLFW_FALSE;
+    }
+
+    if (_glfwFindChosenFBConfig(_glfw.glx.fbconfigs, desired, 0, &handle))
+    {
+        *result = (GLXFBConfig) handle;
+        return GLFW_TRUE;
+    }
+
+    usableConfigs = _glfw_calloc(_glfw.glx.fbconfigs->count, sizeof(_GLFWfbconfig));
+    usableCount = 0;
+
+    for (int i = 0;  i < _glfw.glx.fbconfigs->count;  i++)
+    {
+        const _GLFWfbconfig* c = _glfw.glx.fbconfigs->configs + i;
+        _GLFWfbconfig* u = usableConfigs + usableCount;
+
+        if (c->doublebuffer != desired->doublebuffer)
+            continue;
+
+        *u = *c;
+
+        // Transparency is only considered when it was requested
+        if (!desired->transparent)
+            u->transparent = GLFW_FALSE;
+
         usableCount++;
     }
 
     closest = _glfwChooseFBConfig(desired, usableConfigs, usableCount);
     if (closest)
+    {
         *result = (GLXFBConfig) closest->handle;
+        _glfwAddChosenFBConfig(_glfw.glx.fbconfigs, desired, 0, closest->handle);
+    }
 
-    XFree(nativeConfigs);
     _glfw_free(usableConfigs);
 
     return closest != NULL;
@@ -160,8 +209,12 @@ static void makeContextCurrentGLX(_GLFWwindow* window)
 {
     if (window)
     {
+        GLXDrawable drawable = window->context.glx.window;
+        if (window->contextOnly)
+            drawable = window->context.glx.pbuffer;
+
         if (!glXMakeCurrent(_glfw.x11.display,
-                            window->context.glx.window,
+                            drawable,
                             window->context.glx.handle))
         {
             _glfwInputError(GLFW_PLATFORM_ERROR,
@@ -184,6 +237,17 @@ static void makeContextCurrentGLX(_GLFWwindow* window)
 
 static void swapBuffersGLX(_GLFWwindow* window)
 {
+    // Swap complete events are only selected while there is a callback, as
+    // each event would otherwise also wake up glfwWaitEvents
+    if (_glfw.glx.INTEL_swap_event &&
+        window->context.glx.swapEvents != (window->callbacks.swapComplete != NULL))
+    {
+        window->context.glx.swapEvents = !window->context.glx.swapEvents;
+        glXSelectEvent(_glfw.x11.display, window->context.glx.window,
+                       window->context.glx.swapEvents ?
+                       GLX_BUFFER_SWAP_COMPLETE_INTEL_MASK : 0);
+    }
+
     glXSwapBuffers(_glfw.x11.display, window->context.glx.window);
 }
 
@@ -241,6 +305,12 @@ static void destroyContextGLX(_GLFWwindow* window)
         window->context.glx.window = None;
     }
 
+    if (window->context.glx.pbuffer)
+    {
+        glXDestroyPbuffer(_glfw.x11.display, window->context.glx.pbuffer);
+        window->context.glx.pbuffer = None;
+    }
+
     if (window->context.glx.handle)
     {
         glXDestroyContext(_glfw.x11.display, window->context.glx.handle);
@@ -315,6 +385,12 @@ GLFWbool _glfwInitGLX(void)
         _glfwPlatformGetModuleSymbol(_glfw.glx.handle, "glXDestroyWindow");
     _glfw.glx.GetVisualFromFBConfig = (PFNGLXGETVISUALFROMFBCONFIGPROC)
         _glfwPlatformGetModuleSymbol(_glfw.glx.handle, "glXGetVisualFromFBConfig");
+    _glfw.glx.CreatePbuffer = (PFNGLXCREATEPBUFFERPROC)
+        _glfwPlatformGetModuleSymbol(_glfw.glx.handle, "glXCreatePbuffer");
+    _glfw.glx.DestroyPbuffer = (PFNGLXDESTROYPBUFFERPROC)
+        _glfwPlatformGetModuleSymbol(_glfw.glx.handle, "glXDestroyPbuffer");
+    _glfw.glx.SelectEvent = (PFNGLXSELECTEVENTPROC)
+        _glfwPlatformGetModuleSymbol(_glfw.glx.handle, "glXSelectEvent");
 
     if (!_glfw.glx.GetFBConfigs ||
         !_glfw.glx.GetFBConfigAttrib ||
@@ -328,7 +404,9 @@ GLFWbool _glfwInitGLX(void)
         !_glfw.glx.CreateNewContext ||
         !_glfw.glx.CreateWindow ||
         !_glfw.glx.DestroyWindow ||
-        !_glfw.glx.GetVisualFromFBConfig)
+        !_glfw.glx.GetVisualFromFBConfig ||
+        !_glfw.glx.CreatePbuffer ||
+        !_glfw.glx.DestroyPbuffer)
     {
         _glfwInputError(GLFW_PLATFORM_ERROR,
                         "GLX: Failed to load required entry points");
@@ -423,6 +501,9 @@ GLFWbool _glfwInitGLX(void)
     if (extensionSupportedGLX("GLX_ARB_context_flush_control"))
         _glfw.glx.ARB_context_flush_control = GLFW_TRUE;
 
+    if (extensionSupportedGLX("GLX_INTEL_swap_event") && _glfw.glx.SelectEvent)
+        _glfw.glx.INTEL_swap_event = GLFW_TRUE;
+
     return GLFW_TRUE;
 }
 
@@ -433,6 +514,9 @@ void _glfwTerminateGLX(void)
     // NOTE: This function must not call any X11 functions, as it is called
     //       after XCloseDisplay (see _glfwTerminateX11 for details)
 
+    _glfwFreeFBConfigCache(_glfw.glx.fbconfigs);
+    _glfw.glx.fbconfigs = NULL;
+
     if (_glfw.glx.handle)
     {
         _glfwPlatformFreeModule(_glfw.glx.handle);
@@ -460,13 +544,19 @@ GLFWbool _glfwCreateContextGLX(_GLFWwindow* window,
     if (ctxconfig->share)
         share = ctxconfig->share->context.glx.handle;
 
-    if (!chooseGLXFBConfig(fbconfig, &native))
+    // NOTE: A context without a window uses the GLXFBConfig of the context it
+    //       shares with, to ensure they are compatible
+    if (window->contextOnly)
+        native = ctxconfig->share->context.glx.fbconfig;
+    else if (!chooseGLXFBConfig(fbconfig, &native))
     {
         _glfwInputError(GLFW_FORMAT_UNAVAILABLE,
                         "GLX: Failed to find a suitable GLXFBConfig");
         return GLFW_FALSE;
     }
 
+    window->context.glx.fbconfig = native;
+
     if (ctxconfig->client == GLFW_OPENGL_ES_API)
     {
         if (!_glfw.glx.ARB_create_context ||
@@ -618,12 +708,41 @@ GLFWbool _glfwCreateContextGLX(_GLFWwindow* window,
         return GLFW_FALSE;
     }
 
-    window->context.glx.window =
-        glXCreateWindow(_glfw.x11.display, native, window->x11.handle, NULL);
-    if (!window->context.glx.window)
+    if (window->contextOnly)
     {
-        _glfwInputError(GLFW_PLATFORM_ERROR, "GLX: Failed to create window");
-        return GLFW_FALSE;
+        const int pbufferAttribs[] =
+        {
+            GLX_PBUFFER_WIDTH, 1,
+            GLX_PBUFFER_HEIGHT, 1,
+            None
+        };
+
+        if (!(getGLXFBConfigAttrib(native, GLX_DRAWABLE_TYPE) & GLX_PBUFFER_BIT))
+        {
+            _glfwInputError(GLFW_FORMAT_UNAVAILABLE,
+                            "GLX: The GLXFBConfig of the shared context does not support pbuffers");
+            destroyContextGLX(window);
+            return GLFW_FALSE;
+        }
+
+        window->context.glx.pbuffer =
+            glXCreatePbuffer(_glfw.x11.display, native, pbufferAttribs);
+        if (!window->context.glx.pbuffer)
+        {
+            _glfwInputError(GLFW_PLATFORM_ERROR, "GLX: Failed to create pbuffer");
+            destroyContextGLX(window);
+            return GLFW_FALSE;
+        }
+    }
+    else
+    {
+        window->context.glx.window =
+            glXCreateWindow(_glfw.x11.display, native, window->x11.handle, NULL);
+        if (!window->context.glx.window)
+        {
+            _glfwInputError(GLFW_PLATFORM_ERROR, "GLX: Failed to create window");
+            return GLFW_FALSE;
+        }
     }
 
     window->context.makeCurrent = makeContextCurrentGLX;
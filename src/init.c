@@ -52,6 +52,7 @@ static _GLFWinitconfig _glfwInitHints =
     .hatButtons = GLFW_TRUE,
     .angleType = GLFW_ANGLE_PLATFORM_TYPE_NONE,
     .platformID = GLFW_ANY_PLATFORM,
+    .lazyContextRelease = GLFW_FALSE,
     .vulkanLoader = NULL,
     .ns =
     {
@@ -61,10 +62,12 @@ static _GLFWinitconfig _glfwInitHints =
     .x11 =
     {
         .xcbVulkanSurface = GLFW_TRUE,
+        .cursorPosCache = GLFW_TRUE
     },
     .wl =
     {
-        .libdecorMode = GLFW_WAYLAND_PREFER_LIBDECOR
+        .libdecorMode = GLFW_WAYLAND_PREFER_LIBDECOR,
+        .eventThread = GLFW_FALSE
     },
 };
 
@@ -97,12 +100,18 @@ static void terminate(void)
 
     memset(&_glfw.callbacks, 0, sizeof(_glfw.callbacks));
 
+    while (_glfw.contextListHead)
+        glfwDestroyWindow((GLFWwindow*) _glfw.contextListHead);
+
     while (_glfw.windowListHead)
         glfwDestroyWindow((GLFWwindow*) _glfw.windowListHead);
 
     while (_glfw.cursorListHead)
         glfwDestroyCursor((GLFWcursor*) _glfw.cursorListHead);
 
+    while (_glfw.timerListHead)
+        glfwDestroyTimer((GLFWtimer*) _glfw.timerListHead);
+
     for (i = 0;  i < _glfw.monitorCount;  i++)
     {
         _GLFWmonitor* monitor = _glfw.monitors[i];
@@ -119,6 +128,15 @@ static void terminate(void)
     _glfw.mappings = NULL;
     _glfw.mappingCount = 0;
 
+    _glfw_free(_glfw.eventFds);
+    _glfw.eventFds = NULL;
+    _glfw.eventFdCount = 0;
+
+#if defined(GLFW_BUILD_POSIX_POLL)
+    _glfw_free(_glfw.eventPollFds);
+    _glfw.eventPollFds = NULL;
+#endif
+
     _glfwTerminateVulkan();
     _glfw.platform.terminateJoysticks();
     _glfw.platform.terminate();
@@ -132,9 +150,12 @@ static void terminate(void)
         _glfw_free(error);
     }
 
+    _glfwPlatformDestroyTls(&_glfw.lazyContextSlot);
     _glfwPlatformDestroyTls(&_glfw.contextSlot);
     _glfwPlatformDestroyTls(&_glfw.errorSlot);
     _glfwPlatformDestroyMutex(&_glfw.errorLock);
+    _glfwPlatformDestroyMutex(&_glfw.counterLock);
+    _glfwPlatformDestroyMutex(&_glfw.vk.lock);
 
     memset(&_glfw, 0, sizeof(_glfw));
 }
@@ -175,6 +196,26 @@ size_t _glfwEncodeUTF8(char* s, uint32_t codepoint)
     return count;
 }
 
+// Counts a context change made in the context creation API
+// This may be called from any thread with a current context
+//
+void _glfwCountMakeCurrent(void)
+{
+    _glfwPlatformLockMutex(&_glfw.counterLock);
+    _glfw.counters.makeCurrents++;
+    _glfwPlatformUnlockMutex(&_glfw.counterLock);
+}
+
+// Counts a captured frame that was dropped
+// This may be called from any thread with a current context
+//
+void _glfwCountDroppedFrame(void)
+{
+    _glfwPlatformLockMutex(&_glfw.counterLock);
+    _glfw.counters.droppedFrames++;
+    _glfwPlatformUnlockMutex(&_glfw.counterLock);
+}
+
 // Splits and translates a text/uri-list into separate file paths
 // NOTE: This function destroys the provided string
 //
@@ -414,8 +455,11 @@ GLFWAPI int glfwInit(void)
     }
 
     if (!_glfwPlatformCreateMutex(&_glfw.errorLock) ||
+        !_glfwPlatformCreateMutex(&_glfw.counterLock) ||
+        !_glfwPlatformCreateMutex(&_glfw.vk.lock) ||
         !_glfwPlatformCreateTls(&_glfw.errorSlot) ||
-        !_glfwPlatformCreateTls(&_glfw.contextSlot))
+        !_glfwPlatformCreateTls(&_glfw.contextSlot) ||
+        !_glfwPlatformCreateTls(&_glfw.lazyContextSlot))
     {
         terminate();
         return GLFW_FALSE;
@@ -455,6 +499,9 @@ GLFWAPI void glfwInitHint(int hint, int value)
         case GLFW_PLATFORM:
             _glfwInitHints.platformID = value;
             return;
+        case GLFW_LAZY_CONTEXT_RELEASE:
+            _glfwInitHints.lazyContextRelease = value;
+            return;
         case GLFW_COCOA_CHDIR_RESOURCES:
             _glfwInitHints.ns.chdir = value;
             return;
@@ -464,9 +511,15 @@ GLFWAPI void glfwInitHint(int hint, int value)
         case GLFW_X11_XCB_VULKAN_SURFACE:
             _glfwInitHints.x11.xcbVulkanSurface = value;
             return;
+        case GLFW_X11_CURSOR_POS_CACHE:
+            _glfwInitHints.x11.cursorPosCache = value;
+            return;
         case GLFW_WAYLAND_LIBDECOR:
             _glfwInitHints.wl.libdecorMode = value;
             return;
+        case GLFW_WAYLAND_EVENT_THREAD:
+            _glfwInitHints.wl.eventThread = value;
+            return;
     }
 
     _glfwInputError(GLFW_INVALID_ENUM,
@@ -531,3 +584,45 @@ GLFWAPI GLFWerrorfun glfwSetErrorCallback(GLFWerrorfun cbfun)
     return cbfun;
 }
 
+GLFWAPI uint64_t glfwGetCounter(int counter)
+{
+    _GLFW_REQUIRE_INIT_OR_RETURN(0);
+
+    switch (counter)
+    {
+        case GLFW_COUNTER_EVENTS:
+            return _glfw.counters.events;
+        case GLFW_COUNTER_EVENT_READS:
+            return _glfw.counters.eventReads;
+        case GLFW_COUNTER_FLUSHES:
+            return _glfw.counters.flushes;
+        case GLFW_COUNTER_ROUND_TRIPS:
+            return _glfw.counters.roundTrips;
+        case GLFW_COUNTER_MAKE_CURRENT:
+        {
+            _glfwPlatformLockMutex(&_glfw.counterLock);
+            const uint64_t count = _glfw.counters.makeCurrents;
+            _glfwPlatformUnlockMutex(&_glfw.counterLock);
+            return count;
+        }
+        case GLFW_COUNTER_DROPPED_FRAMES:
+        {
+            _glfwPlatformLockMutex(&_glfw.counterLock);
+            const uint64_t count = _glfw.counters.droppedFrames;
+            _glfwPlatformUnlockMutex(&_glfw.counterLock);
+            return count;
+        }
+    }
+
+    _glfwInputError(GLFW_INVALID_ENUM, "Invalid counter 0x%08X", counter);
+    return 0;
+}
+
+GLFWAPI void glfwResetCounters(void)
+{
+    _GLFW_REQUIRE_INIT();
+
+    _glfwPlatformLockMutex(&_glfw.counterLock);
+    memset(&_glfw.counters, 0, sizeof(_glfw.counters));
+    _glfwPlatformUnlockMutex(&_glfw.counterLock);
+}
@@ -554,6 +554,19 @@ void _glfwCenterCursorInContentArea(_GLFWwindow* window)
     _glfw.platform.setCursorPos(window, width / 2.0, height / 2.0);
 }
 
+// Converts a relative timeout in seconds to an absolute deadline in timer ticks
+//
+uint64_t _glfwGetTimerDeadline(double timeout)
+{
+    const uint64_t now = _glfwPlatformGetTimerValue();
+    const double ticks = timeout * (double) _glfwPlatformGetTimerFrequency();
+
+    if (ticks >= (double) (UINT64_MAX - now))
+        return UINT64_MAX;
+
+    return now + (uint64_t) ticks;
+}
+
 
 //////////////////////////////////////////////////////////////////////////
 //////                        GLFW public API                       //////
@@ -59,6 +59,7 @@
 #define _GLFW_POLL_ALL          (_GLFW_POLL_AXES | _GLFW_POLL_BUTTONS)
 
 #define _GLFW_MESSAGE_SIZE      1024
+#define _GLFW_VK_PROC_CACHE_SIZE 8
 
 typedef int GLFWbool;
 typedef void (*GLFWproc)(void);
@@ -68,6 +69,8 @@ typedef struct _GLFWinitconfig  _GLFWinitconfig;
 typedef struct _GLFWwndconfig   _GLFWwndconfig;
 typedef struct _GLFWctxconfig   _GLFWctxconfig;
 typedef struct _GLFWfbconfig    _GLFWfbconfig;
+typedef struct _GLFWfbconfigchoice _GLFWfbconfigchoice;
+typedef struct _GLFWfbconfigcache _GLFWfbconfigcache;
 typedef struct _GLFWcontext     _GLFWcontext;
 typedef struct _GLFWwindow      _GLFWwindow;
 typedef struct _GLFWplatform    _GLFWplatform;
@@ -77,8 +80,18 @@ typedef struct _GLFWcursor      _GLFWcursor;
 typedef struct _GLFWmapelement  _GLFWmapelement;
 typedef struct _GLFWmapping     _GLFWmapping;
 typedef struct _GLFWjoystick    _GLFWjoystick;
+typedef struct _GLFWeventfd     _GLFWeventfd;
+typedef struct _GLFWtimer       _GLFWtimer;
+typedef struct _GLFWprocentry   _GLFWprocentry;
+typedef struct _GLFWinstanceproc _GLFWinstanceproc;
+typedef struct _GLFWproccache   _GLFWproccache;
+typedef struct _GLFWextension   _GLFWextension;
 typedef struct _GLFWtls         _GLFWtls;
 typedef struct _GLFWmutex       _GLFWmutex;
+typedef struct _GLFWcond        _GLFWcond;
+typedef struct _GLFWthread      _GLFWthread;
+typedef struct _GLFWcapture     _GLFWcapture;
+typedef struct _GLFWpresent     _GLFWpresent;
 
 #define GL_VERSION 0x1f02
 #define GL_NONE 0
@@ -106,6 +119,7 @@ typedef unsigned int GLbitfield;
 typedef unsigned char GLubyte;
 
 typedef void (APIENTRY * PFNGLCLEARPROC)(GLbitfield);
+typedef void (APIENTRY * PFNGLFINISHPROC)(void);
 typedef const GLubyte* (APIENTRY * PFNGLGETSTRINGPROC)(GLenum);
 typedef void (APIENTRY * PFNGLGETINTEGERVPROC)(GLenum,GLint*);
 typedef const GLubyte* (APIENTRY * PFNGLGETSTRINGIPROC)(GLenum,GLuint);
@@ -237,8 +251,10 @@ typedef GLFWglproc (APIENTRY * PFN_eglGetProcAddress)(const char*);
 
 typedef EGLDisplay (APIENTRY * PFNEGLGETPLATFORMDISPLAYEXTPROC)(EGLenum,void*,const EGLint*);
 typedef EGLSurface (APIENTRY * PFNEGLCREATEPLATFORMWINDOWSURFACEEXTPROC)(EGLDisplay,EGLConfig,void*,const EGLint*);
+typedef EGLBoolean (APIENTRY * PFNEGLSWAPBUFFERSWITHDAMAGEKHRPROC)(EGLDisplay,EGLSurface,const EGLint*,EGLint);
 #define eglGetPlatformDisplayEXT _glfw.egl.GetPlatformDisplayEXT
 #define eglCreatePlatformWindowSurfaceEXT _glfw.egl.CreatePlatformWindowSurfaceEXT
+#define eglSwapBuffersWithDamageKHR _glfw.egl.SwapBuffersWithDamageKHR
 
 #define OSMESA_RGBA 0x1908
 #define OSMESA_FORMAT 0x22
@@ -325,10 +341,26 @@ typedef struct VkExtensionProperties
     uint32_t        specVersion;
 } VkExtensionProperties;
 
+typedef struct VkExtent3D
+{
+    uint32_t        width;
+    uint32_t        height;
+    uint32_t        depth;
+} VkExtent3D;
+
+typedef struct VkQueueFamilyProperties
+{
+    VkFlags         queueFlags;
+    uint32_t        queueCount;
+    uint32_t        timestampValidBits;
+    VkExtent3D      minImageTransferGranularity;
+} VkQueueFamilyProperties;
+
 typedef void (APIENTRY * PFN_vkVoidFunction)(void);
 
 typedef PFN_vkVoidFunction (APIENTRY * PFN_vkGetInstanceProcAddr)(VkInstance,const char*);
 typedef VkResult (APIENTRY * PFN_vkEnumerateInstanceExtensionProperties)(const char*,uint32_t*,VkExtensionProperties*);
+typedef void (APIENTRY * PFN_vkGetPhysicalDeviceQueueFamilyProperties)(VkPhysicalDevice,uint32_t*,VkQueueFamilyProperties*);
 #define vkGetInstanceProcAddr _glfw.vk.GetInstanceProcAddr
 
 #include "platform.h"
@@ -377,6 +409,7 @@ struct _GLFWinitconfig
     GLFWbool      hatButtons;
     int           angleType;
     int           platformID;
+    GLFWbool      lazyContextRelease;
     PFN_vkGetInstanceProcAddr vulkanLoader;
     struct {
         GLFWbool  menubar;
@@ -384,9 +417,11 @@ struct _GLFWinitconfig
     } ns;
     struct {
         GLFWbool  xcbVulkanSurface;
+        GLFWbool  cursorPosCache;
     } x11;
     struct {
         int       libdecorMode;
+        GLFWbool  eventThread;
     } wl;
 };
 
@@ -413,6 +448,8 @@ struct _GLFWwndconfig
     GLFWbool      centerCursor;
     GLFWbool      focusOnShow;
     GLFWbool      mousePassthrough;
+    GLFWbool      swapStatistics;
+    GLFWbool      presentThread;
     GLFWbool      scaleToMonitor;
     GLFWbool      scaleFramebuffer;
     struct {
@@ -484,6 +521,30 @@ struct _GLFWfbconfig
     uintptr_t   handle;
 };
 
+// Framebuffer config chosen for a set of framebuffer hints
+//
+struct _GLFWfbconfigchoice
+{
+    _GLFWfbconfig   desired;
+    // Context API specific part of the request, like the client API
+    int             key;
+    uintptr_t       handle;
+};
+
+// Framebuffer configs of a context API, enumerated once per display
+//
+struct _GLFWfbconfigcache
+{
+    // Translated native configs
+    _GLFWfbconfig*  configs;
+    // Client APIs supported by each config, for context APIs that need it
+    int*            apis;
+    int             count;
+    // Configs already chosen from the translated ones
+    _GLFWfbconfigchoice* choices;
+    int             choiceCount;
+};
+
 // Context structure
 //
 struct _GLFWcontext
@@ -502,16 +563,33 @@ struct _GLFWcontext
 
     void (*makeCurrent)(_GLFWwindow*);
     void (*swapBuffers)(_GLFWwindow*);
+    // Optional, buffer swaps with damage fall back to swapBuffers if NULL
+    void (*swapBuffersWithDamage)(_GLFWwindow*,const int*,int);
     void (*swapInterval)(int);
     int (*extensionSupported)(const char*);
     GLFWglproc (*getProcAddress)(const char*);
     void (*destroy)(_GLFWwindow*);
 
+    // Entry points resolved so far, shared by all contexts in the share group
+    _GLFWproccache*     procCache;
+
+    // Open addressing hash table of the client API extensions of the context
+    // and of every other extension name queried so far
+    struct {
+        _GLFWextension* entries;
+        unsigned int    size;
+        unsigned int    count;
+    } extensions;
+
     struct {
         EGLConfig       config;
         EGLContext      handle;
         EGLSurface      surface;
         void*           client;
+        // Size and color space of the pbuffer used as the default framebuffer
+        // on the Null platform
+        int             width, height;
+        GLFWbool        sRGB;
     } egl;
 
     struct {
@@ -519,6 +597,12 @@ struct _GLFWcontext
         int             width;
         int             height;
         void*           buffer;
+        // Caller-provided color buffers, rendered to in turn
+        void**          buffers;
+        int             bufferCount;
+        int             bufferIndex;
+        int             bufferWidth;
+        int             bufferHeight;
     } osmesa;
 
     // This is defined in platform.h
@@ -561,8 +645,34 @@ struct _GLFWwindow
     double              virtualCursorPosX, virtualCursorPosY;
     GLFWbool            rawMouseMotion;
 
+    // Frame pacing state for glfwWaitForNextFrame, in timer ticks
+    uint64_t            frameMargin;
+    uint64_t            framePeriod;
+    uint64_t            frameDeadline;
+
+    // Buffer swap statistics, recorded only if enabled
+    GLFWbool            swapStatistics;
+    GLFWswapstats       swapStats;
+    // Timer values of the end of the last buffer swap and of the refresh
+    // period used to detect missed deadlines
+    uint64_t            lastSwap;
+    uint64_t            swapPeriod;
+
+    // Nesting level of glfwBeginWindowUpdate, during which platform updates
+    // may be deferred until the matching glfwEndWindowUpdate
+    int                 updateLevel;
+
+    // The object holds a context created by glfwCreateSharedContexts and has
+    // no native window
+    GLFWbool            contextOnly;
+
     _GLFWcontext        context;
 
+    // Frame capture started by glfwStartFrameCapture, or NULL
+    _GLFWcapture*       capture;
+    // Present thread performing buffer swaps, or NULL
+    _GLFWpresent*       present;
+
     struct {
         GLFWwindowposfun          pos;
         GLFWwindowsizefun         size;
@@ -573,6 +683,7 @@ struct _GLFWwindow
         GLFWwindowmaximizefun     maximize;
         GLFWframebuffersizefun    fbsize;
         GLFWwindowcontentscalefun scale;
+        GLFWswapcompletefun       swapComplete;
         GLFWmousebuttonfun        mouseButton;
         GLFWcursorposfun          cursorPos;
         GLFWcursorenterfun        cursorEnter;
@@ -661,6 +772,29 @@ struct _GLFWjoystick
     GLFW_PLATFORM_JOYSTICK_STATE
 };
 
+// Application event file descriptor structure
+//
+struct _GLFWeventfd
+{
+    int             fd;
+    int             events;
+    GLFWeventfdfun  callback;
+    void*           userPointer;
+};
+
+// Event loop timer structure
+//
+struct _GLFWtimer
+{
+    _GLFWtimer*     next;
+    // Absolute deadline in timer ticks, or zero if the timer is not armed
+    uint64_t        deadline;
+    uint64_t        interval;
+    GLFWbool        repeat;
+    GLFWtimerfun    callback;
+    void*           userPointer;
+};
+
 // Thread local storage structure
 //
 struct _GLFWtls
@@ -677,6 +811,68 @@ struct _GLFWmutex
     GLFW_PLATFORM_MUTEX_STATE
 };
 
+// Condition variable structure
+//
+struct _GLFWcond
+{
+    // This is defined in platform.h
+    GLFW_PLATFORM_COND_STATE
+};
+
+// Thread structure
+//
+struct _GLFWthread
+{
+    void            (*function)(void*);
+    void*           argument;
+
+    // This is defined in platform.h
+    GLFW_PLATFORM_THREAD_STATE
+};
+
+// Resolved context entry point structure
+//
+struct _GLFWprocentry
+{
+    // The entry point name, or NULL if the slot is empty
+    char*           name;
+    uint32_t        hash;
+    GLFWglproc      proc;
+};
+
+// Resolved Vulkan instance function structure
+//
+struct _GLFWinstanceproc
+{
+    // The function name, which is always a string literal
+    const char*         name;
+    PFN_vkVoidFunction  proc;
+};
+
+// Context extension structure
+//
+struct _GLFWextension
+{
+    // The extension name, or NULL if the slot is empty
+    char*           name;
+    uint32_t        hash;
+    GLFWbool        supported;
+};
+
+// Context entry point cache structure
+//
+struct _GLFWproccache
+{
+    // Contexts in the share group using this cache
+    int             refs;
+    // Serializes access from contexts current on different threads
+    _GLFWmutex      mutex;
+    // Open addressing hash table with a power of two size
+    _GLFWprocentry* entries;
+    unsigned int    size;
+    unsigned int    count;
+};
+
 // Platform API structure
 //
 struct _GLFWplatform
@@ -716,6 +912,7 @@ struct _GLFWplatform
     // window
     GLFWbool (*createWindow)(_GLFWwindow*,const _GLFWwndconfig*,const _GLFWctxconfig*,const _GLFWfbconfig*);
     void (*destroyWindow)(_GLFWwindow*);
+    GLFWbool (*createSharedContext)(_GLFWwindow*,const _GLFWctxconfig*,const _GLFWfbconfig*);
     void (*setWindowTitle)(_GLFWwindow*,const char*);
     void (*setWindowIcon)(_GLFWwindow*,int,const GLFWimage*);
     void (*getWindowPos)(_GLFWwindow*,int*,int*);
@@ -747,9 +944,11 @@ struct _GLFWplatform
     void (*setWindowFloating)(_GLFWwindow*,GLFWbool);
     void (*setWindowOpacity)(_GLFWwindow*,float);
     void (*setWindowMousePassthrough)(_GLFWwindow*,GLFWbool);
+    void (*endWindowUpdate)(_GLFWwindow*);
     void (*pollEvents)(void);
     void (*waitEvents)(void);
     void (*waitEventsTimeout)(double);
+    void (*waitEventsUntil)(uint64_t);
     void (*postEmptyEvent)(void);
     // EGL
     EGLenum (*getEGLPlatform)(EGLint**);
@@ -757,7 +956,7 @@ struct _GLFWplatform
     EGLNativeWindowType (*getEGLNativeWindow)(_GLFWwindow*);
     // vulkan
     void (*getRequiredInstanceExtensions)(char**);
-    GLFWbool (*getPhysicalDevicePresentationSupport)(VkInstance,VkPhysicalDevice,uint32_t);
+    GLFWbool (*getPhysicalDevicePresentationSupport)(VkInstance,VkPhysicalDevice,uint32_t,uint32_t,int*);
     VkResult (*createWindowSurface)(VkInstance,_GLFWwindow*,const VkAllocationCallbacks*,VkSurfaceKHR*);
 };
 
@@ -781,6 +980,8 @@ struct _GLFWlibrary
     _GLFWerror*         errorListHead;
     _GLFWcursor*        cursorListHead;
     _GLFWwindow*        windowListHead;
+    _GLFWwindow*        contextListHead;
+    _GLFWtimer*         timerListHead;
 
     _GLFWmonitor**      monitors;
     int                 monitorCount;
@@ -790,9 +991,31 @@ struct _GLFWlibrary
     _GLFWmapping*       mappings;
     int                 mappingCount;
 
+    _GLFWeventfd*       eventFds;
+    int                 eventFdCount;
+#if defined(GLFW_BUILD_POSIX_POLL)
+    // Poll array with room for the platform file descriptors followed by one
+    // entry per application file descriptor
+    struct pollfd*      eventPollFds;
+#endif
+
+    struct {
+        uint64_t        events;
+        uint64_t        eventReads;
+        uint64_t        flushes;
+        uint64_t        roundTrips;
+        uint64_t        makeCurrents;
+        uint64_t        droppedFrames;
+    } counters;
+
     _GLFWtls            errorSlot;
     _GLFWtls            contextSlot;
+    // Context no longer current for GLFW but still current in the context
+    // creation API, because its release was deferred
+    _GLFWtls            lazyContextSlot;
     _GLFWmutex          errorLock;
+    // Guards the counters that may be updated from any thread
+    _GLFWmutex          counterLock;
 
     struct {
         uint64_t        offset;
@@ -805,6 +1028,8 @@ struct _GLFWlibrary
         EGLDisplay      display;
         EGLint          major, minor;
         GLFWbool        prefix;
+        // Usable EGLConfigs, enumerated on first use
+        _GLFWfbconfigcache* fbconfigs;
 
         GLFWbool        KHR_create_context;
         GLFWbool        KHR_create_context_no_error;
@@ -816,6 +1041,9 @@ struct _GLFWlibrary
         GLFWbool        EXT_platform_x11;
         GLFWbool        EXT_platform_wayland;
         GLFWbool        EXT_present_opaque;
+        GLFWbool        KHR_surfaceless_context;
+        GLFWbool        KHR_swap_buffers_with_damage;
+        GLFWbool        EXT_swap_buffers_with_damage;
         GLFWbool        ANGLE_platform_angle;
         GLFWbool        ANGLE_platform_angle_opengl;
         GLFWbool        ANGLE_platform_angle_d3d;
@@ -845,6 +1073,7 @@ struct _GLFWlibrary
 
         PFNEGLGETPLATFORMDISPLAYEXTPROC GetPlatformDisplayEXT;
         PFNEGLCREATEPLATFORMWINDOWSURFACEEXTPROC CreatePlatformWindowSurfaceEXT;
+        PFNEGLSWAPBUFFERSWITHDAMAGEKHRPROC SwapBuffersWithDamageKHR;
     } egl;
 
     struct {
@@ -857,6 +1086,7 @@ struct _GLFWlibrary
         PFN_OSMesaGetColorBuffer        GetColorBuffer;
         PFN_OSMesaGetDepthBuffer        GetDepthBuffer;
         PFN_OSMesaGetProcAddress        GetProcAddress;
+        PFNGLFINISHPROC                 Finish;
 
     } osmesa;
 
@@ -873,6 +1103,10 @@ struct _GLFWlibrary
         GLFWbool        KHR_xcb_surface;
         GLFWbool        KHR_wayland_surface;
         GLFWbool        EXT_headless_surface;
+        // Physical device functions resolved through the loader
+        _GLFWmutex      lock;
+        _GLFWinstanceproc procs[_GLFW_VK_PROC_CACHE_SIZE];
+        int             procCount;
     } vk;
 
     struct {
@@ -909,6 +1143,16 @@ void _glfwPlatformDestroyMutex(_GLFWmutex* mutex);
 void _glfwPlatformLockMutex(_GLFWmutex* mutex);
 void _glfwPlatformUnlockMutex(_GLFWmutex* mutex);
 
+GLFWbool _glfwPlatformCreateCond(_GLFWcond* cond);
+void _glfwPlatformDestroyCond(_GLFWcond* cond);
+void _glfwPlatformWaitCond(_GLFWcond* cond, _GLFWmutex* mutex);
+void _glfwPlatformSignalCond(_GLFWcond* cond);
+
+GLFWbool _glfwPlatformCreateThread(_GLFWthread* thread,
+                                   void (*function)(void*),
+                                   void* argument);
+void _glfwPlatformJoinThread(_GLFWthread* thread);
+
 void* _glfwPlatformLoadModule(const char* path);
 void _glfwPlatformFreeModule(void* module);
 GLFWproc _glfwPlatformGetModuleSymbol(void* module, const char* name);
@@ -927,6 +1171,7 @@ void _glfwInputWindowContentScale(_GLFWwindow* window,
 void _glfwInputWindowIconify(_GLFWwindow* window, GLFWbool iconified);
 void _glfwInputWindowMaximize(_GLFWwindow* window, GLFWbool maximized);
 void _glfwInputWindowDamage(_GLFWwindow* window);
+void _glfwInputSwapComplete(_GLFWwindow* window, uint64_t time, uint64_t sequence);
 void _glfwInputWindowCloseRequest(_GLFWwindow* window);
 void _glfwInputWindowMonitor(_GLFWwindow* window, _GLFWmonitor* monitor);
 
@@ -944,6 +1189,8 @@ void _glfwInputJoystickAxis(_GLFWjoystick* js, int axis, float value);
 void _glfwInputJoystickButton(_GLFWjoystick* js, int button, char value);
 void _glfwInputJoystickHat(_GLFWjoystick* js, int hat, char value);
 
+void _glfwInputEventFd(int fd, int events);
+
 void _glfwInputMonitor(_GLFWmonitor* monitor, int action, int placement);
 void _glfwInputMonitorWindow(_GLFWmonitor* monitor, _GLFWwindow* window);
 
@@ -965,10 +1212,29 @@ GLFWbool _glfwStringInExtensionString(const char* string, const char* extensions
 const _GLFWfbconfig* _glfwChooseFBConfig(const _GLFWfbconfig* desired,
                                          const _GLFWfbconfig* alternatives,
                                          unsigned int count);
+_GLFWfbconfigcache* _glfwCreateFBConfigCache(int count);
+void _glfwFreeFBConfigCache(_GLFWfbconfigcache* cache);
+GLFWbool _glfwFindChosenFBConfig(const _GLFWfbconfigcache* cache,
+                                 const _GLFWfbconfig* desired,
+                                 int key, uintptr_t* handle);
+void _glfwAddChosenFBConfig(_GLFWfbconfigcache* cache,
+                            const _GLFWfbconfig* desired,
+                            int key, uintptr_t handle);
 GLFWbool _glfwRefreshContextAttribs(_GLFWwindow* window,
                                     const _GLFWctxconfig* ctxconfig);
+void _glfwReleaseProcCache(_GLFWwindow* window);
+void _glfwFreeContextExtensions(_GLFWwindow* window);
 GLFWbool _glfwIsValidContextConfig(const _GLFWctxconfig* ctxconfig);
 
+void _glfwCaptureFrame(_GLFWwindow* window);
+void _glfwStopCapture(_GLFWwindow* window);
+
+void _glfwPresentBuffers(_GLFWwindow* window, const int* rects, int count);
+GLFWbool _glfwCreatePresentThread(_GLFWwindow* window);
+void _glfwDestroyPresentThread(_GLFWwindow* window);
+void _glfwQueuePresent(_GLFWwindow* window, const int* rects, int count);
+void _glfwWaitForPresent(_GLFWwindow* window);
+
 const GLFWvidmode* _glfwChooseVideoMode(_GLFWmonitor* monitor,
                                         const GLFWvidmode* desired);
 int _glfwCompareVideoModes(const GLFWvidmode* first, const GLFWvidmode* second);
@@ -986,6 +1252,7 @@ _GLFWjoystick* _glfwAllocJoystick(const char* name,
                                   int hatCount);
 void _glfwFreeJoystick(_GLFWjoystick* js);
 void _glfwCenterCursorInContentArea(_GLFWwindow* window);
+uint64_t _glfwGetTimerDeadline(double timeout);
 
 GLFWbool _glfwInitEGL(void);
 void _glfwTerminateEGL(void);
@@ -1007,9 +1274,13 @@ GLFWbool _glfwCreateContextOSMesa(_GLFWwindow* window,
 
 GLFWbool _glfwInitVulkan(int mode);
 void _glfwTerminateVulkan(void);
+PFN_vkVoidFunction _glfwGetCachedInstanceProc(VkInstance instance,
+                                              const char* procname);
 const char* _glfwGetVulkanResultString(VkResult result);
 
 size_t _glfwEncodeUTF8(char* s, uint32_t codepoint);
+void _glfwCountMakeCurrent(void);
+void _glfwCountDroppedFrame(void);
 char** _glfwParseUriList(char* text, int* count);
 
 char* _glfw_strdup(const char* source);
@@ -338,9 +338,13 @@ GLFWbool _glfwCreateContextNSGL(_GLFWwindow* window,
                                   forParameter:NSOpenGLContextParameterSurfaceOpacity];
     }
 
-    [window->ns.view setWantsBestResolutionOpenGLSurface:window->ns.scaleFramebuffer];
+    // NOTE: A context without a window is not attached to any view
+    if (!window->contextOnly)
+    {
+        [window->ns.view setWantsBestResolutionOpenGLSurface:window->ns.scaleFramebuffer];
 
-    [window->context.nsgl.object setView:window->ns.view];
+        [window->context.nsgl.object setView:window->ns.view];
+    }
 
     window->context.makeCurrent = makeContextCurrentNSGL;
     window->context.swapBuffers = swapBuffersNSGL;
@@ -70,6 +70,7 @@ GLFWbool _glfwConnectNull(int platformID, _GLFWplatform* platform)
         .setGammaRamp = _glfwSetGammaRampNull,
         .createWindow = _glfwCreateWindowNull,
         .destroyWindow = _glfwDestroyWindowNull,
+        .createSharedContext = _glfwCreateSharedContextNull,
         .setWindowTitle = _glfwSetWindowTitleNull,
         .setWindowIcon = _glfwSetWindowIconNull,
         .getWindowPos = _glfwGetWindowPosNull,
@@ -101,9 +102,11 @@ GLFWbool _glfwConnectNull(int platformID, _GLFWplatform* platform)
         .setWindowFloating = _glfwSetWindowFloatingNull,
         .setWindowOpacity = _glfwSetWindowOpacityNull,
         .setWindowMousePassthrough = _glfwSetWindowMousePassthroughNull,
+        .endWindowUpdate = _glfwEndWindowUpdateNull,
         .pollEvents = _glfwPollEventsNull,
         .waitEvents = _glfwWaitEventsNull,
         .waitEventsTimeout = _glfwWaitEventsTimeoutNull,
+        .waitEventsUntil = _glfwWaitEventsUntilNull,
         .postEmptyEvent = _glfwPostEmptyEventNull,
         .getEGLPlatform = _glfwGetEGLPlatformNull,
         .getEGLNativeDisplay = _glfwGetEGLNativeDisplayNull,
@@ -251,12 +254,20 @@ int _glfwInitNull(void)
             _glfw.null.scancodes[_glfw.null.keycodes[scancode]] = scancode;
     }
 
+#if defined(GLFW_BUILD_POSIX_POLL)
+    if (!_glfwCreateEmptyEventPOSIX(&_glfw.null.emptyEvent))
+        return GLFW_FALSE;
+#endif
+
     _glfwPollMonitorsNull();
     return GLFW_TRUE;
 }
 
 void _glfwTerminateNull(void)
 {
+#if defined(GLFW_BUILD_POSIX_POLL)
+    _glfwDestroyEmptyEventPOSIX(&_glfw.null.emptyEvent);
+#endif
     free(_glfw.null.clipboardString);
     _glfwTerminateOSMesa();
     _glfwTerminateEGL();
@@ -107,6 +107,26 @@ static int createNativeWindow(_GLFWwindow* window,
 }
 
 
+// Waits for an application file descriptor or an empty event
+// NOTE: There are no window system events, so waiting without a deadline only
+//       blocks if the application has added file descriptors that can end it
+//
+static void waitForAnyEvent(const uint64_t* deadline)
+{
+#if defined(GLFW_BUILD_POSIX_POLL)
+    struct pollfd fd = { _glfw.null.emptyEvent.fds[0], POLLIN };
+
+    if (!deadline && !_glfw.eventFdCount)
+        return;
+
+    if (_glfwPollEventFdsPOSIX(&fd, 1, deadline, NULL))
+    {
+        if (fd.revents & POLLIN)
+            _glfwDrainEmptyEventPOSIX(&_glfw.null.emptyEvent);
+    }
+#endif
+}
+
 //////////////////////////////////////////////////////////////////////////
 //////                       GLFW platform API                      //////
 //////////////////////////////////////////////////////////////////////////
@@ -178,6 +198,16 @@ void _glfwDestroyWindowNull(_GLFWwindow* window)
         window->context.destroy(window);
 }
 
+GLFWbool _glfwCreateSharedContextNull(_GLFWwindow* window,
+                                      const _GLFWctxconfig* ctxconfig,
+                                      const _GLFWfbconfig* fbconfig)
+{
+    if (ctxconfig->source == GLFW_EGL_CONTEXT_API)
+        return _glfwCreateContextEGL(window, ctxconfig, fbconfig);
+    else
+        return _glfwCreateContextOSMesa(window, ctxconfig, fbconfig);
+}
+
 void _glfwSetWindowTitleNull(_GLFWwindow* window, const char* title)
 {
 }
@@ -408,6 +438,10 @@ void _glfwSetWindowMousePassthroughNull(_GLFWwindow* window, GLFWbool enabled)
 {
 }
 
+void _glfwEndWindowUpdateNull(_GLFWwindow* window)
+{
+}
+
 float _glfwGetWindowOpacityNull(_GLFWwindow* window)
 {
     return window->null.opacity;
@@ -487,18 +521,38 @@ GLFWbool _glfwWindowVisibleNull(_GLFWwindow* window)
 
 void _glfwPollEventsNull(void)
 {
+#if defined(GLFW_BUILD_POSIX_POLL)
+    const uint64_t deadline = 0;
+    _glfwPollEventFdsPOSIX(NULL, 0, &deadline, NULL);
+
+    if (_glfwEmptyEventPendingPOSIX(&_glfw.null.emptyEvent))
+        _glfwDrainEmptyEventPOSIX(&_glfw.null.emptyEvent);
+#endif
 }
 
 void _glfwWaitEventsNull(void)
 {
+    waitForAnyEvent(NULL);
 }
 
 void _glfwWaitEventsTimeoutNull(double timeout)
 {
+#if defined(GLFW_BUILD_POSIX_POLL)
+    const uint64_t deadline = _glfwGetTimerDeadline(timeout);
+    waitForAnyEvent(&deadline);
+#endif
+}
+
+void _glfwWaitEventsUntilNull(uint64_t deadline)
+{
+    waitForAnyEvent(&deadline);
 }
 
 void _glfwPostEmptyEventNull(void)
 {
+#if defined(GLFW_BUILD_POSIX_POLL)
+    _glfwPostEmptyEventPOSIX(&_glfw.null.emptyEvent);
+#endif
 }
 
 void _glfwGetCursorPosNull(_GLFWwindow* window, double* xpos, double* ypos)
@@ -712,8 +766,13 @@ void _glfwGetRequiredInstanceExtensionsNull(char** extensions)
 
 GLFWbool _glfwGetPhysicalDevicePresentationSupportNull(VkInstance instance,
                                                        VkPhysicalDevice device,
-                                                       uint32_t queuefamily)
+                                                       uint32_t first,
+                                                       uint32_t count,
+                                                       int* supported)
 {
+    for (uint32_t i = 0;  i < count;  i++)
+        supported[i] = GLFW_TRUE;
+
     return GLFW_TRUE;
 }
 
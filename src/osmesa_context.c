@@ -35,24 +35,41 @@ static void makeContextCurrentOSMesa(_GLFWwindow* window)
 {
     if (window)
     {
-        int width, height;
-        _glfw.platform.getFramebufferSize(window, &width, &height);
+        int width = 1, height = 1;
+        void* buffer;
 
-        // Check to see if we need to allocate a new buffer
-        if ((window->context.osmesa.buffer == NULL) ||
-            (width != window->context.osmesa.width) ||
-            (height != window->context.osmesa.height))
+        if (window->context.osmesa.bufferCount)
         {
-            _glfw_free(window->context.osmesa.buffer);
-
-            // Allocate the new buffer (width * height * 8-bit RGBA)
-            window->context.osmesa.buffer = _glfw_calloc(4, (size_t) width * height);
-            window->context.osmesa.width  = width;
-            window->context.osmesa.height = height;
+            // Render directly into the caller-provided buffer for this frame
+            buffer = window->context.osmesa.buffers[window->context.osmesa.bufferIndex];
+            width = window->context.osmesa.bufferWidth;
+            height = window->context.osmesa.bufferHeight;
+        }
+        else
+        {
+            // NOTE: A context without a window has no framebuffer size, so it
+            //       only gets a minimal buffer to be made current with
+            if (!window->contextOnly)
+                _glfw.platform.getFramebufferSize(window, &width, &height);
+
+            // Check to see if we need to allocate a new buffer
+            if ((window->context.osmesa.buffer == NULL) ||
+                (width != window->context.osmesa.width) ||
+                (height != window->context.osmesa.height))
+            {
+                _glfw_free(window->context.osmesa.buffer);
+
+                // Allocate the new buffer (width * height * 8-bit RGBA)
+                window->context.osmesa.buffer = _glfw_calloc(4, (size_t) width * height);
+                window->context.osmesa.width  = width;
+                window->context.osmesa.height = height;
+            }
+
+            buffer = window->context.osmesa.buffer;
         }
 
         if (!OSMesaMakeCurrent(window->context.osmesa.handle,
-                               window->context.osmesa.buffer,
+                               buffer,
                                GL_UNSIGNED_BYTE,
                                width, height))
         {
@@ -84,11 +101,35 @@ static void destroyContextOSMesa(_GLFWwindow* window)
         window->context.osmesa.width = 0;
         window->context.osmesa.height = 0;
     }
+
+    _glfw_free(window->context.osmesa.buffers);
+    window->context.osmesa.buffers = NULL;
+    window->context.osmesa.bufferCount = 0;
 }
 
 static void swapBuffersOSMesa(_GLFWwindow* window)
 {
-    // No double buffering on OSMesa
+    // No double buffering on OSMesa, but caller-provided buffers are rotated
+    if (window->context.osmesa.bufferCount)
+    {
+        const GLFWbool current =
+            _glfwPlatformGetTls(&_glfw.contextSlot) == window;
+
+        // The finished frame must be complete before the caller reads it
+        if (current && _glfw.osmesa.Finish)
+            _glfw.osmesa.Finish();
+
+        if (window->context.osmesa.bufferCount > 1)
+        {
+            window->context.osmesa.bufferIndex =
+                (window->context.osmesa.bufferIndex + 1) %
+                window->context.osmesa.bufferCount;
+
+            // Otherwise the next buffer is used when the context is made current
+            if (current)
+                makeContextCurrentOSMesa(window);
+        }
+    }
 }
 
 static void swapIntervalOSMesa(int interval)
@@ -175,6 +216,8 @@ GLFWbool _glfwInitOSMesa(void)
         return GLFW_FALSE;
     }
 
+    _glfw.osmesa.Finish = (PFNGLFINISHPROC) OSMesaGetProcAddress("glFinish");
+
     return GLFW_TRUE;
 }
 
@@ -308,9 +351,18 @@ GLFWAPI int glfwGetOSMesaColorBuffer(GLFWwindow* handle, int* width,
         return GLFW_FALSE;
     }
 
-    if (!OSMesaGetColorBuffer(window->context.osmesa.handle,
-                              &mesaWidth, &mesaHeight,
-                              &mesaFormat, &mesaBuffer))
+    if (window->context.osmesa.bufferCount)
+    {
+        // The caller-provided buffer for the current frame is reported even if
+        // the context has not been made current with it yet
+        mesaBuffer = window->context.osmesa.buffers[window->context.osmesa.bufferIndex];
+        mesaWidth = window->context.osmesa.bufferWidth;
+        mesaHeight = window->context.osmesa.bufferHeight;
+        mesaFormat = OSMESA_RGBA;
+    }
+    else if (!OSMesaGetColorBuffer(window->context.osmesa.handle,
+                                   &mesaWidth, &mesaHeight,
+                                   &mesaFormat, &mesaBuffer))
     {
         _glfwInputError(GLFW_PLATFORM_ERROR,
                         "OSMesa: Failed to retrieve color buffer");
@@ -329,6 +381,70 @@ GLFWAPI int glfwGetOSMesaColorBuffer(GLFWwindow* handle, int* width,
     return GLFW_TRUE;
 }
 
+GLFWAPI int glfwSetOSMesaColorBuffers(GLFWwindow* handle,
+                                      int width, int height,
+                                      int count, void* const* buffers)
+{
+    int i;
+
+    _GLFW_REQUIRE_INIT_OR_RETURN(GLFW_FALSE);
+
+    _GLFWwindow* window = (_GLFWwindow*) handle;
+    assert(window != NULL);
+    assert(count >= 0);
+
+    if (window->context.source != GLFW_OSMESA_CONTEXT_API)
+    {
+        _glfwInputError(GLFW_NO_WINDOW_CONTEXT, NULL);
+        return GLFW_FALSE;
+    }
+
+    if (count < 0 || (count > 0 && (width <= 0 || height <= 0 || !buffers)))
+    {
+        _glfwInputError(GLFW_INVALID_VALUE,
+                        "Invalid OSMesa color buffers %i of size %ix%i",
+                        count, width, height);
+        return GLFW_FALSE;
+    }
+
+    for (i = 0;  i < count;  i++)
+    {
+        if (!buffers[i])
+        {
+            _glfwInputError(GLFW_INVALID_VALUE,
+                            "Invalid OSMesa color buffer %i", i);
+            return GLFW_FALSE;
+        }
+    }
+
+    if (count > window->context.osmesa.bufferCount)
+    {
+        void** array = _glfw_realloc(window->context.osmesa.buffers,
+                                     count * sizeof(void*));
+        if (!array)
+        {
+            _glfwInputError(GLFW_OUT_OF_MEMORY, NULL);
+            return GLFW_FALSE;
+        }
+
+        window->context.osmesa.buffers = array;
+    }
+
+    if (count)
+        memcpy(window->context.osmesa.buffers, buffers, count * sizeof(void*));
+
+    window->context.osmesa.bufferCount = count;
+    window->context.osmesa.bufferIndex = 0;
+    window->context.osmesa.bufferWidth = width;
+    window->context.osmesa.bufferHeight = height;
+
+    // Otherwise the buffers are used when the context is next made current
+    if (_glfwPlatformGetTls(&_glfw.contextSlot) == window)
+        makeContextCurrentOSMesa(window);
+
+    return GLFW_TRUE;
+}
+
 GLFWAPI int glfwGetOSMesaDepthBuffer(GLFWwindow* handle,
                                      int* width, int* height,
                                      int* bytesPerValue,
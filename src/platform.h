@@ -37,6 +37,15 @@
  #error "You must not define these; define zero or more _GLFW_<platform> macros instead"
 #endif
 
+#if defined(_GLFW_WAYLAND) || defined(_GLFW_X11) || \
+    (!defined(_WIN32) && !defined(__APPLE__))
+ #define GLFW_BUILD_POSIX_POLL
+#endif
+
+#if defined(GLFW_BUILD_POSIX_POLL)
+ #include "posix_poll.h"
+#endif
+
 #include "null_platform.h"
 #define GLFW_EXPOSE_NATIVE_EGL
 #define GLFW_EXPOSE_NATIVE_OSMESA
@@ -175,10 +184,14 @@
  #include "win32_thread.h"
  #define GLFW_PLATFORM_TLS_STATE    GLFW_WIN32_TLS_STATE
  #define GLFW_PLATFORM_MUTEX_STATE  GLFW_WIN32_MUTEX_STATE
+ #define GLFW_PLATFORM_COND_STATE   GLFW_WIN32_COND_STATE
+ #define GLFW_PLATFORM_THREAD_STATE GLFW_WIN32_THREAD_STATE
 #elif defined(GLFW_BUILD_POSIX_THREAD)
  #include "posix_thread.h"
  #define GLFW_PLATFORM_TLS_STATE    GLFW_POSIX_TLS_STATE
  #define GLFW_PLATFORM_MUTEX_STATE  GLFW_POSIX_MUTEX_STATE
+ #define GLFW_PLATFORM_COND_STATE   GLFW_POSIX_COND_STATE
+ #define GLFW_PLATFORM_THREAD_STATE GLFW_POSIX_THREAD_STATE
 #endif
 
 #if defined(_WIN32)
@@ -206,7 +219,3 @@
  #define GLFW_BUILD_POSIX_MODULE
 #endif
 
-#if defined(_GLFW_WAYLAND) || defined(_GLFW_X11)
- #define GLFW_BUILD_POSIX_POLL
-#endif
-
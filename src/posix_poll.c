@@ -33,39 +33,62 @@
 #include <signal.h>
 #include <time.h>
 #include <errno.h>
+#include <string.h>
+#include <unistd.h>
+#include <fcntl.h>
+#include <limits.h>
+#include <assert.h>
 
-GLFWbool _glfwPollPOSIX(struct pollfd* fds, nfds_t count, double* timeout)
+#if defined(__linux__)
+ #include <sys/eventfd.h>
+#endif
+
+// Polls the specified file descriptors until one becomes ready or the absolute
+// deadline in timer ticks has passed
+// The remaining time is recomputed from the deadline in integer ticks after
+// every interruption, so repeated waits do not accumulate rounding errors
+//
+GLFWbool _glfwPollUntilPOSIX(struct pollfd* fds, nfds_t count, const uint64_t* deadline)
 {
     for (;;)
     {
-        if (timeout)
+        if (deadline)
         {
-            const uint64_t base = _glfwPlatformGetTimerValue();
+            const uint64_t frequency = _glfwPlatformGetTimerFrequency();
+            const uint64_t now = _glfwPlatformGetTimerValue();
+            const uint64_t remaining = *deadline > now ? *deadline - now : 0;
 
 #if defined(__linux__) || defined(__FreeBSD__) || defined(__OpenBSD__) || defined(__CYGWIN__)
-            const time_t seconds = (time_t) *timeout;
-            const long nanoseconds = (long) ((*timeout - seconds) * 1e9);
-            const struct timespec ts = { seconds, nanoseconds };
+            const struct timespec ts =
+            {
+                (time_t) (remaining / frequency),
+                (long) ((remaining % frequency) * 1000000000 / frequency)
+            };
             const int result = ppoll(fds, count, &ts, NULL);
 #elif defined(__NetBSD__)
-            const time_t seconds = (time_t) *timeout;
-            const long nanoseconds = (long) ((*timeout - seconds) * 1e9);
-            const struct timespec ts = { seconds, nanoseconds };
+            const struct timespec ts =
+            {
+                (time_t) (remaining / frequency),
+                (long) ((remaining % frequency) * 1000000000 / frequency)
+            };
             const int result = pollts(fds, count, &ts, NULL);
 #else
-            const int milliseconds = (int) (*timeout * 1e3);
+            // Round up so the wait does not end before the deadline
+            int milliseconds = INT_MAX;
+            if (remaining / frequency < INT_MAX / 1000)
+            {
+                milliseconds = (int) ((remaining / frequency) * 1000 +
+                    ((remaining % frequency) * 1000 + frequency - 1) / frequency);
+            }
             const int result = poll(fds, count, milliseconds);
 #endif
             const int error = errno; // clock_gettime may overwrite our error
 
-            *timeout -= (_glfwPlatformGetTimerValue() - base) /
-                (double) _glfwPlatformGetTimerFrequency();
-
             if (result > 0)
                 return GLFW_TRUE;
             else if (result == -1 && error != EINTR && error != EAGAIN)
                 return GLFW_FALSE;
-            else if (*timeout <= 0.0)
+            else if (remaining == 0 || _glfwPlatformGetTimerValue() >= *deadline)
                 return GLFW_FALSE;
         }
         else
@@ -79,5 +102,243 @@ GLFWbool _glfwPollPOSIX(struct pollfd* fds, nfds_t count, double* timeout)
     }
 }
 
+GLFWbool _glfwPollPOSIX(struct pollfd* fds, nfds_t count, double* timeout)
+{
+    if (!timeout)
+        return _glfwPollUntilPOSIX(fds, count, NULL);
+
+    const uint64_t deadline = _glfwGetTimerDeadline(*timeout);
+    const GLFWbool result = _glfwPollUntilPOSIX(fds, count, &deadline);
+
+    const uint64_t now = _glfwPlatformGetTimerValue();
+    if (deadline > now)
+        *timeout = (deadline - now) / (double) _glfwPlatformGetTimerFrequency();
+    else
+        *timeout = 0.0;
+
+    return result;
+}
+
+// Polls the specified file descriptors together with those added by the
+// application, then calls the callbacks of any application file descriptors
+// that became ready
+//
+GLFWbool _glfwPollEventFdsPOSIX(struct pollfd* fds, nfds_t count, const uint64_t* deadline,
+                                GLFWbool* dispatched)
+{
+    if (dispatched)
+        *dispatched = GLFW_FALSE;
+
+    if (_glfw.eventFdCount == 0)
+    {
+        if (count == 0)
+            return GLFW_FALSE;
+
+        return _glfwPollUntilPOSIX(fds, count, deadline);
+    }
+
+    assert(count <= _GLFW_POLL_PLATFORM_FDS);
+
+    // The platform file descriptors are placed right before those added by the
+    // application, which are kept up to date by glfwAddEventFd and
+    // glfwRemoveEventFd, so the persistent array can be polled directly
+    struct pollfd* all = _glfw.eventPollFds + _GLFW_POLL_PLATFORM_FDS - count;
+    const nfds_t total = count + _glfw.eventFdCount;
+
+    for (nfds_t i = 0;  i < count;  i++)
+        all[i] = fds[i];
+
+    const GLFWbool result = _glfwPollUntilPOSIX(all, total, deadline);
+
+    for (nfds_t i = 0;  i < count;  i++)
+        fds[i].revents = all[i].revents;
+
+    if (result)
+    {
+        // NOTE: Callbacks may add or remove file descriptors, which can move
+        //       the array and its entries, so it is indexed anew each time and
+        //       each descriptor is looked up again by _glfwInputEventFd
+        // NOTE: The array is walked backwards, as removal moves the last entry
+        //       into the removed slot and that entry has then already been
+        //       dispatched and had its events cleared
+        for (int i = _glfw.eventFdCount - 1;  i >= 0;  i--)
+        {
+            // Callbacks may have removed several entries
+            if (i >= _glfw.eventFdCount)
+                continue;
+
+            struct pollfd* pfd = _glfw.eventPollFds + _GLFW_POLL_PLATFORM_FDS + i;
+            int events = 0;
+
+            if (pfd->revents & POLLIN)
+                events |= GLFW_EVENT_FD_READ;
+            if (pfd->revents & POLLOUT)
+                events |= GLFW_EVENT_FD_WRITE;
+            if (pfd->revents & (POLLERR | POLLHUP | POLLNVAL))
+                events |= GLFW_EVENT_FD_ERROR;
+
+            pfd->revents = 0;
+
+            if (events)
+            {
+                _glfwInputEventFd(pfd->fd, events);
+
+                if (dispatched)
+                    *dispatched = GLFW_TRUE;
+            }
+        }
+    }
+
+    return result;
+}
+
+// Creates the empty event object, using an eventfd where available and
+// otherwise a pipe without assuming the OS has pipe2(2)
+//
+GLFWbool _glfwCreateEmptyEventPOSIX(_GLFWemptyEventPOSIX* event)
+{
+    event->pending = GLFW_FALSE;
+
+    event->lock = _glfw_calloc(1, sizeof(_GLFWmutex));
+    if (!event->lock)
+    {
+        _glfwInputError(GLFW_OUT_OF_MEMORY, NULL);
+        return GLFW_FALSE;
+    }
+
+    if (!_glfwPlatformCreateMutex(event->lock))
+        return GLFW_FALSE;
+
+#if defined(__linux__)
+    const int fd = eventfd(0, EFD_CLOEXEC | EFD_NONBLOCK);
+    if (fd != -1)
+    {
+        event->fds[0] = event->fds[1] = fd;
+        return GLFW_TRUE;
+    }
+#endif
+
+    if (pipe(event->fds) != 0)
+    {
+        _glfwInputError(GLFW_PLATFORM_ERROR,
+                        "POSIX: Failed to create empty event pipe: %s",
+                        strerror(errno));
+        return GLFW_FALSE;
+    }
+
+    for (int i = 0; i < 2; i++)
+    {
+        const int sf = fcntl(event->fds[i], F_GETFL, 0);
+        const int df = fcntl(event->fds[i], F_GETFD, 0);
+
+        if (sf == -1 || df == -1 ||
+            fcntl(event->fds[i], F_SETFL, sf | O_NONBLOCK) == -1 ||
+            fcntl(event->fds[i], F_SETFD, df | FD_CLOEXEC) == -1)
+        {
+            _glfwInputError(GLFW_PLATFORM_ERROR,
+                            "POSIX: Failed to set flags for empty event pipe: %s",
+                            strerror(errno));
+            return GLFW_FALSE;
+        }
+    }
+
+    return GLFW_TRUE;
+}
+
+void _glfwDestroyEmptyEventPOSIX(_GLFWemptyEventPOSIX* event)
+{
+    if (event->fds[0] || event->fds[1])
+    {
+        close(event->fds[0]);
+        if (event->fds[1] != event->fds[0])
+            close(event->fds[1]);
+    }
+
+    if (event->lock)
+    {
+        _glfwPlatformDestroyMutex(event->lock);
+        _glfw_free(event->lock);
+    }
+
+    memset(event, 0, sizeof(_GLFWemptyEventPOSIX));
+}
+
+// Wakes up the event wait unless an empty event is already pending, in which
+// case the wait has not yet consumed it and the write can be skipped
+//
+void _glfwPostEmptyEventPOSIX(_GLFWemptyEventPOSIX* event)
+{
+    _glfwPlatformLockMutex(event->lock);
+    const GLFWbool pending = event->pending;
+    event->pending = GLFW_TRUE;
+    _glfwPlatformUnlockMutex(event->lock);
+
+    if (pending)
+        return;
+
+    for (;;)
+    {
+#if defined(__linux__)
+        if (event->fds[0] == event->fds[1])
+        {
+            const uint64_t value = 1;
+            const ssize_t result = write(event->fds[1], &value, sizeof(value));
+            if (result == sizeof(value) || (result == -1 && errno != EINTR))
+                break;
+
+            continue;
+        }
+#endif
+
+        const char byte = 0;
+        const ssize_t result = write(event->fds[1], &byte, 1);
+        if (result == 1 || (result == -1 && errno != EINTR))
+            break;
+    }
+}
+
+// Returns whether an empty event has been posted and not yet drained
+//
+GLFWbool _glfwEmptyEventPendingPOSIX(_GLFWemptyEventPOSIX* event)
+{
+    _glfwPlatformLockMutex(event->lock);
+    const GLFWbool pending = event->pending;
+    _glfwPlatformUnlockMutex(event->lock);
+    return pending;
+}
+
+// Drains the empty event object and allows the next post to wake up the wait
+// This must be called when the read end has been reported readable, even if no
+// empty event is pending, as a post may race with the previous drain
+//
+void _glfwDrainEmptyEventPOSIX(_GLFWemptyEventPOSIX* event)
+{
+    for (;;)
+    {
+#if defined(__linux__)
+        if (event->fds[0] == event->fds[1])
+        {
+            // A single read resets the eventfd counter however many posts it
+            // has accumulated
+            uint64_t value;
+            const ssize_t result = read(event->fds[0], &value, sizeof(value));
+            if (result != -1 || errno != EINTR)
+                break;
+
+            continue;
+        }
+#endif
+
+        char dummy[64];
+        const ssize_t result = read(event->fds[0], dummy, sizeof(dummy));
+        if (result == -1 && errno != EINTR)
+            break;
+    }
+
+    _glfwPlatformLockMutex(event->lock);
+    event->pending = GLFW_FALSE;
+    _glfwPlatformUnlockMutex(event->lock);
+}
+
 #endif // GLFW_BUILD_POSIX_POLL
 
@@ -26,5 +26,30 @@
 
 #include <poll.h>
 
+// The most file descriptors a platform passes to _glfwPollEventFdsPOSIX
+#define _GLFW_POLL_PLATFORM_FDS 5
+
+// Empty event object used to wake up the event wait from any thread
+//
+typedef struct _GLFWemptyEventPOSIX
+{
+    // The read and write ends, which are the same eventfd on Linux
+    int             fds[2];
+    // Set while an empty event has been posted but not yet drained
+    GLFWbool        pending;
+    // Guards the pending flag, as empty events may be posted from any thread
+    // This is allocated, as the mutex structure is not yet defined here
+    _GLFWmutex*     lock;
+} _GLFWemptyEventPOSIX;
+
 GLFWbool _glfwPollPOSIX(struct pollfd* fds, nfds_t count, double* timeout);
+GLFWbool _glfwPollUntilPOSIX(struct pollfd* fds, nfds_t count, const uint64_t* deadline);
+GLFWbool _glfwPollEventFdsPOSIX(struct pollfd* fds, nfds_t count, const uint64_t* deadline,
+                                GLFWbool* dispatched);
+
+GLFWbool _glfwCreateEmptyEventPOSIX(_GLFWemptyEventPOSIX* event);
+void _glfwDestroyEmptyEventPOSIX(_GLFWemptyEventPOSIX* event);
+void _glfwPostEmptyEventPOSIX(_GLFWemptyEventPOSIX* event);
+GLFWbool _glfwEmptyEventPendingPOSIX(_GLFWemptyEventPOSIX* event);
+void _glfwDrainEmptyEventPOSIX(_GLFWemptyEventPOSIX* event);
 
@@ -33,6 +33,14 @@
 #include <string.h>
 
 
+static void* threadMainPOSIX(void* argument)
+{
+    _GLFWthread* thread = argument;
+    thread->function(thread->argument);
+    return NULL;
+}
+
+
 //////////////////////////////////////////////////////////////////////////
 //////                       GLFW platform API                      //////
 //////////////////////////////////////////////////////////////////////////
@@ -103,5 +111,68 @@ void _glfwPlatformUnlockMutex(_GLFWmutex* mutex)
     pthread_mutex_unlock(&mutex->posix.handle);
 }
 
+GLFWbool _glfwPlatformCreateCond(_GLFWcond* cond)
+{
+    assert(cond->posix.allocated == GLFW_FALSE);
+
+    if (pthread_cond_init(&cond->posix.handle, NULL) != 0)
+    {
+        _glfwInputError(GLFW_PLATFORM_ERROR,
+                        "POSIX: Failed to create condition variable");
+        return GLFW_FALSE;
+    }
+
+    return cond->posix.allocated = GLFW_TRUE;
+}
+
+void _glfwPlatformDestroyCond(_GLFWcond* cond)
+{
+    if (cond->posix.allocated)
+        pthread_cond_destroy(&cond->posix.handle);
+    memset(cond, 0, sizeof(_GLFWcond));
+}
+
+void _glfwPlatformWaitCond(_GLFWcond* cond, _GLFWmutex* mutex)
+{
+    assert(cond->posix.allocated == GLFW_TRUE);
+    assert(mutex->posix.allocated == GLFW_TRUE);
+    pthread_cond_wait(&cond->posix.handle, &mutex->posix.handle);
+}
+
+void _glfwPlatformSignalCond(_GLFWcond* cond)
+{
+    assert(cond->posix.allocated == GLFW_TRUE);
+    pthread_cond_signal(&cond->posix.handle);
+}
+
+GLFWbool _glfwPlatformCreateThread(_GLFWthread* thread,
+                                   void (*function)(void*),
+                                   void* argument)
+{
+    assert(thread->posix.allocated == GLFW_FALSE);
+
+    thread->function = function;
+    thread->argument = argument;
+
+    const int result = pthread_create(&thread->posix.handle, NULL,
+                                      threadMainPOSIX, thread);
+    if (result != 0)
+    {
+        _glfwInputError(GLFW_PLATFORM_ERROR,
+                        "POSIX: Failed to create thread: %s",
+                        strerror(result));
+        return GLFW_FALSE;
+    }
+
+    return thread->posix.allocated = GLFW_TRUE;
+}
+
+void _glfwPlatformJoinThread(_GLFWthread* thread)
+{
+    if (thread->posix.allocated)
+        pthread_join(thread->posix.handle, NULL);
+    memset(thread, 0, sizeof(_GLFWthread));
+}
+
 #endif // GLFW_BUILD_POSIX_THREAD
 
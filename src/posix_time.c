@@ -33,6 +33,31 @@
 #include <sys/time.h>
 
 
+//////////////////////////////////////////////////////////////////////////
+//////                       GLFW internal API                      //////
+//////////////////////////////////////////////////////////////////////////
+
+// Converts a time point of the specified clock to a timer value
+//
+uint64_t _glfwClockToTimerValuePOSIX(clockid_t clock,
+                                     uint64_t seconds, uint64_t nanoseconds)
+{
+    uint64_t value = seconds * _glfw.timer.posix.frequency + nanoseconds;
+
+    // The difference between the clocks is sampled, as presentation clocks
+    // are usually but not always the one used by the timer
+    if (clock != _glfw.timer.posix.clock)
+    {
+        struct timespec ts;
+        clock_gettime(clock, &ts);
+        value += _glfwPlatformGetTimerValue() -
+            ((uint64_t) ts.tv_sec * _glfw.timer.posix.frequency + (uint64_t) ts.tv_nsec);
+    }
+
+    return value;
+}
+
+
 //////////////////////////////////////////////////////////////////////////
 //////                       GLFW platform API                      //////
 //////////////////////////////////////////////////////////////////////////
@@ -39,3 +39,7 @@ typedef struct _GLFWtimerPOSIX
     uint64_t    frequency;
 } _GLFWtimerPOSIX;
 
+
+uint64_t _glfwClockToTimerValuePOSIX(clockid_t clock,
+                                     uint64_t seconds, uint64_t nanoseconds);
+
@@ -0,0 +1,202 @@
+//========================================================================
+// GLFW 3.5 - www.glfw.org
+//------------------------------------------------------------------------
+// Copyright (c) 2006-2016 Camilla Löwy <elmindreda@glfw.org>
+//
+// This software is provided 'as-is', without any express or implied
+// warranty. In no event will the authors be held liable for any damages
+// arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it
+// freely, subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented; you must not
+//    claim that you wrote the original software. If you use this software
+//    in a product, an acknowledgment in the product documentation would
+//    be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such, and must not
+//    be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source
+//    distribution.
+//
+//========================================================================
+
+#include "internal.h"
+
+#include <string.h>
+
+// Present thread state of a window
+//
+struct _GLFWpresent
+{
+    _GLFWwindow*        window;
+
+    // Damage rectangles of the queued buffer swap
+    int*                rects;
+    int                 rectCount;
+    int                 rectCapacity;
+
+    // A buffer swap is pending while its sequence number is ahead of the last
+    // completed one, which acts as the fence waited on by the context owner
+    uint64_t            requested;
+    uint64_t            completed;
+    GLFWbool            stop;
+
+    _GLFWmutex          mutex;
+    _GLFWcond           request;
+    _GLFWcond           complete;
+    _GLFWthread         thread;
+};
+
+// Performs queued buffer swaps with the context of the window until stopped
+//
+static void presentThreadMain(void* argument)
+{
+    _GLFWpresent* present = argument;
+    _GLFWwindow* window = present->window;
+
+    _glfwPlatformLockMutex(&present->mutex);
+
+    for (;;)
+    {
+        while (present->requested == present->completed && !present->stop)
+            _glfwPlatformWaitCond(&present->request, &present->mutex);
+
+        if (present->requested == present->completed)
+            break;
+
+        _glfwPlatformUnlockMutex(&present->mutex);
+
+        // The context was released by the thread that queued the swap and is
+        // not made current again there until the swap has completed
+        window->context.makeCurrent(window);
+        _glfwPresentBuffers(window, present->rects, present->rectCount);
+        window->context.makeCurrent(NULL);
+
+        _glfwPlatformLockMutex(&present->mutex);
+
+        present->completed++;
+        _glfwPlatformSignalCond(&present->complete);
+    }
+
+    _glfwPlatformUnlockMutex(&present->mutex);
+}
+
+
+//////////////////////////////////////////////////////////////////////////
+//////                       GLFW internal API                      //////
+//////////////////////////////////////////////////////////////////////////
+
+// Starts the present thread of the window
+//
+GLFWbool _glfwCreatePresentThread(_GLFWwindow* window)
+{
+    _GLFWpresent* present = _glfw_calloc(1, sizeof(_GLFWpresent));
+    if (!present)
+    {
+        _glfwInputError(GLFW_OUT_OF_MEMORY, NULL);
+        return GLFW_FALSE;
+    }
+
+    present->window = window;
+    window->present = present;
+
+    if (!_glfwPlatformCreateMutex(&present->mutex) ||
+        !_glfwPlatformCreateCond(&present->request) ||
+        !_glfwPlatformCreateCond(&present->complete) ||
+        !_glfwPlatformCreateThread(&present->thread, presentThreadMain, present))
+    {
+        _glfwDestroyPresentThread(window);
+        return GLFW_FALSE;
+    }
+
+    return GLFW_TRUE;
+}
+
+// Waits for any pending buffer swap and stops the present thread of the window
+//
+void _glfwDestroyPresentThread(_GLFWwindow* window)
+{
+    _GLFWpresent* present = window->present;
+    if (!present)
+        return;
+
+    if (present->thread.function)
+    {
+        _glfwPlatformLockMutex(&present->mutex);
+        present->stop = GLFW_TRUE;
+        _glfwPlatformSignalCond(&present->request);
+        _glfwPlatformUnlockMutex(&present->mutex);
+
+        _glfwPlatformJoinThread(&present->thread);
+    }
+
+    _glfwPlatformDestroyCond(&present->complete);
+    _glfwPlatformDestroyCond(&present->request);
+    _glfwPlatformDestroyMutex(&present->mutex);
+
+    _glfw_free(present->rects);
+    _glfw_free(present);
+
+    window->present = NULL;
+}
+
+// Releases the context of the window from the calling thread and queues
+// a buffer swap on the present thread
+//
+void _glfwQueuePresent(_GLFWwindow* window, const int* rects, int count)
+{
+    _GLFWpresent* present = window->present;
+
+    if (window != _glfwPlatformGetTls(&_glfw.contextSlot))
+    {
+        _glfwInputError(GLFW_NO_CURRENT_CONTEXT,
+                        "The context must be current on the calling thread when queuing a buffer swap");
+        return;
+    }
+
+    // The present thread is idle, as the context could not have been made
+    // current here again before the previous swap completed
+    if (count > present->rectCapacity)
+    {
+        int* rects = _glfw_realloc(present->rects, count * 4 * sizeof(int));
+        if (!rects)
+        {
+            _glfwInputError(GLFW_OUT_OF_MEMORY, NULL);
+            return;
+        }
+
+        present->rects = rects;
+        present->rectCapacity = count;
+    }
+
+    if (count)
+        memcpy(present->rects, rects, count * 4 * sizeof(int));
+    present->rectCount = count;
+
+    window->context.makeCurrent(NULL);
+    _glfwCountMakeCurrent();
+
+    _glfwPlatformLockMutex(&present->mutex);
+    present->requested++;
+    _glfwPlatformSignalCond(&present->request);
+    _glfwPlatformUnlockMutex(&present->mutex);
+}
+
+// Waits until any buffer swap queued for the window has completed
+//
+void _glfwWaitForPresent(_GLFWwindow* window)
+{
+    _GLFWpresent* present = window->present;
+
+    _glfwPlatformLockMutex(&present->mutex);
+
+    while (present->requested != present->completed)
+        _glfwPlatformWaitCond(&present->complete, &present->mutex);
+
+    _glfwPlatformUnlockMutex(&present->mutex);
+}
+
@@ -157,10 +157,58 @@ GLFWbool _glfwInitVulkan(int mode)
 
 void _glfwTerminateVulkan(void)
 {
+    _glfw.vk.procCount = 0;
+
     if (_glfw.vk.handle)
         _glfwPlatformFreeModule(_glfw.vk.handle);
 }
 
+// Returns the specified physical device function, resolving it only on the
+// first request if the loader was loaded by GLFW
+//
+PFN_vkVoidFunction _glfwGetCachedInstanceProc(VkInstance instance,
+                                              const char* procname)
+{
+    PFN_vkVoidFunction proc = NULL;
+
+    // The Vulkan loader returns the same trampoline for a physical device
+    // function for every instance, as it dispatches on the physical device.
+    // A loader provided by the application may instead return functions
+    // specific to the instance, and instance handles may be reused after
+    // the instance is destroyed, so those functions are never cached
+    if (!_glfw.vk.handle)
+        return vkGetInstanceProcAddr(instance, procname);
+
+    _glfwPlatformLockMutex(&_glfw.vk.lock);
+
+    for (int i = 0;  i < _glfw.vk.procCount;  i++)
+    {
+        const _GLFWinstanceproc* entry = _glfw.vk.procs + i;
+        if (strcmp(entry->name, procname) == 0)
+        {
+            proc = entry->proc;
+            break;
+        }
+    }
+
+    if (!proc)
+    {
+        // Functions that could not be resolved are not cached, as the lookup
+        // fails with an error anyway
+        proc = vkGetInstanceProcAddr(instance, procname);
+        if (proc && _glfw.vk.procCount < _GLFW_VK_PROC_CACHE_SIZE)
+        {
+            _GLFWinstanceproc* entry = _glfw.vk.procs + _glfw.vk.procCount;
+            entry->name = procname;
+            entry->proc = proc;
+            _glfw.vk.procCount++;
+        }
+    }
+
+    _glfwPlatformUnlockMutex(&_glfw.vk.lock);
+    return proc;
+}
+
 const char* _glfwGetVulkanResultString(VkResult result)
 {
     switch (result)
@@ -289,9 +337,76 @@ GLFWAPI int glfwGetPhysicalDevicePresentationSupport(VkInstance instance,
         return GLFW_FALSE;
     }
 
-    return _glfw.platform.getPhysicalDevicePresentationSupport(instance,
-                                                               device,
-                                                               queuefamily);
+    int supported;
+    if (!_glfw.platform.getPhysicalDevicePresentationSupport(instance,
+                                                             device,
+                                                             queuefamily, 1,
+                                                             &supported))
+    {
+        return GLFW_FALSE;
+    }
+
+    return supported;
+}
+
+GLFWAPI int glfwGetQueueFamilyPresentationSupport(VkInstance instance,
+                                                  VkPhysicalDevice device,
+                                                  uint32_t* count,
+                                                  int* supported)
+{
+    assert(count != NULL);
+
+    const uint32_t capacity = *count;
+    *count = 0;
+
+    _GLFW_REQUIRE_INIT_OR_RETURN(GLFW_FALSE);
+
+    assert(instance != VK_NULL_HANDLE);
+    assert(device != VK_NULL_HANDLE);
+
+    if (!_glfwInitVulkan(_GLFW_REQUIRE_LOADER))
+        return GLFW_FALSE;
+
+    if (!_glfw.vk.extensions[0])
+    {
+        _glfwInputError(GLFW_API_UNAVAILABLE,
+                        "Vulkan: Window surface creation extensions not found");
+        return GLFW_FALSE;
+    }
+
+    PFN_vkGetPhysicalDeviceQueueFamilyProperties
+        vkGetPhysicalDeviceQueueFamilyProperties =
+        (PFN_vkGetPhysicalDeviceQueueFamilyProperties)
+        _glfwGetCachedInstanceProc(instance, "vkGetPhysicalDeviceQueueFamilyProperties");
+    if (!vkGetPhysicalDeviceQueueFamilyProperties)
+    {
+        _glfwInputError(GLFW_API_UNAVAILABLE,
+                        "Vulkan: Failed to retrieve vkGetPhysicalDeviceQueueFamilyProperties");
+        return GLFW_FALSE;
+    }
+
+    uint32_t familyCount;
+    vkGetPhysicalDeviceQueueFamilyProperties(device, &familyCount, NULL);
+
+    if (!supported)
+    {
+        *count = familyCount;
+        return GLFW_TRUE;
+    }
+
+    if (familyCount > capacity)
+        familyCount = capacity;
+
+    if (!_glfw.platform.getPhysicalDevicePresentationSupport(instance,
+                                                             device,
+                                                             0, familyCount,
+                                                             supported))
+    {
+        return GLFW_FALSE;
+    }
+
+    *count = familyCount;
+    return GLFW_TRUE;
 }
 
 GLFWAPI VkResult glfwCreateWindowSurface(VkInstance instance,
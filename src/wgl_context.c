@@ -550,31 +550,38 @@ GLFWbool _glfwCreateContextWGL(_GLFWwindow* window,
     if (ctxconfig->share)
         share = ctxconfig->share->context.wgl.handle;
 
-    window->context.wgl.dc = GetDC(window->win32.handle);
-    if (!window->context.wgl.dc)
+    // NOTE: A context without a window uses the DC of the window it shares
+    //       with, which already has a compatible pixel format
+    if (window->contextOnly)
+        window->context.wgl.dc = ctxconfig->share->context.wgl.dc;
+    else
     {
-        _glfwInputError(GLFW_PLATFORM_ERROR,
-                        "WGL: Failed to retrieve DC for window");
-        return GLFW_FALSE;
-    }
+        window->context.wgl.dc = GetDC(window->win32.handle);
+        if (!window->context.wgl.dc)
+        {
+            _glfwInputError(GLFW_PLATFORM_ERROR,
+                            "WGL: Failed to retrieve DC for window");
+            return GLFW_FALSE;
+        }
 
-    pixelFormat = choosePixelFormatWGL(window, ctxconfig, fbconfig);
-    if (!pixelFormat)
-        return GLFW_FALSE;
+        pixelFormat = choosePixelFormatWGL(window, ctxconfig, fbconfig);
+        if (!pixelFormat)
+            return GLFW_FALSE;
 
-    if (!DescribePixelFormat(window->context.wgl.dc,
-                             pixelFormat, sizeof(pfd), &pfd))
-    {
-        _glfwInputErrorWin32(GLFW_PLATFORM_ERROR,
-                             "WGL: Failed to retrieve PFD for selected pixel format");
-        return GLFW_FALSE;
-    }
+        if (!DescribePixelFormat(window->context.wgl.dc,
+                                 pixelFormat, sizeof(pfd), &pfd))
+        {
+            _glfwInputErrorWin32(GLFW_PLATFORM_ERROR,
+                                 "WGL: Failed to retrieve PFD for selected pixel format");
+            return GLFW_FALSE;
+        }
 
-    if (!SetPixelFormat(window->context.wgl.dc, pixelFormat, &pfd))
-    {
-        _glfwInputErrorWin32(GLFW_PLATFORM_ERROR,
-                             "WGL: Failed to set selected pixel format");
-        return GLFW_FALSE;
+        if (!SetPixelFormat(window->context.wgl.dc, pixelFormat, &pfd))
+        {
+            _glfwInputErrorWin32(GLFW_PLATFORM_ERROR,
+                                 "WGL: Failed to set selected pixel format");
+            return GLFW_FALSE;
+        }
     }
 
     if (ctxconfig->client == GLFW_OPENGL_API)
@@ -629,6 +629,7 @@ GLFWbool _glfwConnectWin32(int platformID, _GLFWplatform* platform)
         .setGammaRamp = _glfwSetGammaRampWin32,
         .createWindow = _glfwCreateWindowWin32,
         .destroyWindow = _glfwDestroyWindowWin32,
+        .createSharedContext = _glfwCreateSharedContextWin32,
         .setWindowTitle = _glfwSetWindowTitleWin32,
         .setWindowIcon = _glfwSetWindowIconWin32,
         .getWindowPos = _glfwGetWindowPosWin32,
@@ -660,9 +661,11 @@ GLFWbool _glfwConnectWin32(int platformID, _GLFWplatform* platform)
         .setWindowFloating = _glfwSetWindowFloatingWin32,
         .setWindowOpacity = _glfwSetWindowOpacityWin32,
         .setWindowMousePassthrough = _glfwSetWindowMousePassthroughWin32,
+        .endWindowUpdate = _glfwEndWindowUpdateWin32,
         .pollEvents = _glfwPollEventsWin32,
         .waitEvents = _glfwWaitEventsWin32,
         .waitEventsTimeout = _glfwWaitEventsTimeoutWin32,
+        .waitEventsUntil = _glfwWaitEventsUntilWin32,
         .postEmptyEvent = _glfwPostEmptyEventWin32,
         .getEGLPlatform = _glfwGetEGLPlatformWin32,
         .getEGLNativeDisplay = _glfwGetEGLNativeDisplayWin32,
@@ -32,6 +32,14 @@
 #include <assert.h>
 
 
+static DWORD WINAPI threadMainWin32(LPVOID argument)
+{
+    _GLFWthread* thread = argument;
+    thread->function(thread->argument);
+    return 0;
+}
+
+
 //////////////////////////////////////////////////////////////////////////
 //////                       GLFW platform API                      //////
 //////////////////////////////////////////////////////////////////////////
@@ -96,5 +104,61 @@ void _glfwPlatformUnlockMutex(_GLFWmutex* mutex)
     LeaveCriticalSection(&mutex->win32.section);
 }
 
+GLFWbool _glfwPlatformCreateCond(_GLFWcond* cond)
+{
+    assert(cond->win32.allocated == GLFW_FALSE);
+    InitializeConditionVariable(&cond->win32.handle);
+    return cond->win32.allocated = GLFW_TRUE;
+}
+
+void _glfwPlatformDestroyCond(_GLFWcond* cond)
+{
+    // Condition variables have no resources to release on Win32
+    memset(cond, 0, sizeof(_GLFWcond));
+}
+
+void _glfwPlatformWaitCond(_GLFWcond* cond, _GLFWmutex* mutex)
+{
+    assert(cond->win32.allocated == GLFW_TRUE);
+    assert(mutex->win32.allocated == GLFW_TRUE);
+    SleepConditionVariableCS(&cond->win32.handle, &mutex->win32.section, INFINITE);
+}
+
+void _glfwPlatformSignalCond(_GLFWcond* cond)
+{
+    assert(cond->win32.allocated == GLFW_TRUE);
+    WakeConditionVariable(&cond->win32.handle);
+}
+
+GLFWbool _glfwPlatformCreateThread(_GLFWthread* thread,
+                                   void (*function)(void*),
+                                   void* argument)
+{
+    assert(thread->win32.allocated == GLFW_FALSE);
+
+    thread->function = function;
+    thread->argument = argument;
+
+    thread->win32.handle = CreateThread(NULL, 0, threadMainWin32, thread, 0, NULL);
+    if (!thread->win32.handle)
+    {
+        _glfwInputError(GLFW_PLATFORM_ERROR, "Win32: Failed to create thread");
+        return GLFW_FALSE;
+    }
+
+    return thread->win32.allocated = GLFW_TRUE;
+}
+
+void _glfwPlatformJoinThread(_GLFWthread* thread)
+{
+    if (thread->win32.allocated)
+    {
+        WaitForSingleObject(thread->win32.handle, INFINITE);
+        CloseHandle(thread->win32.handle);
+    }
+
+    memset(thread, 0, sizeof(_GLFWthread));
+}
+
 #endif // GLFW_BUILD_WIN32_THREAD
 
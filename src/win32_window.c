@@ -1509,6 +1509,18 @@ void _glfwDestroyWindowWin32(_GLFWwindow* window)
         DestroyIcon(window->win32.smallIcon);
 }
 
+GLFWbool _glfwCreateSharedContextWin32(_GLFWwindow* window,
+                                       const _GLFWctxconfig* ctxconfig,
+                                       const _GLFWfbconfig* fbconfig)
+{
+    if (ctxconfig->source == GLFW_NATIVE_CONTEXT_API)
+        return _glfwCreateContextWGL(window, ctxconfig, fbconfig);
+    else if (ctxconfig->source == GLFW_EGL_CONTEXT_API)
+        return _glfwCreateContextEGL(window, ctxconfig, fbconfig);
+    else
+        return _glfwCreateContextOSMesa(window, ctxconfig, fbconfig);
+}
+
 void _glfwSetWindowTitleWin32(_GLFWwindow* window, const char* title)
 {
     WCHAR* wideTitle = _glfwCreateWideStringFromUTF8Win32(title);
@@ -1971,6 +1983,11 @@ void _glfwSetWindowMousePassthroughWin32(_GLFWwindow* window, GLFWbool enabled)
         SetLayeredWindowAttributes(window->win32.handle, key, alpha, flags);
 }
 
+void _glfwEndWindowUpdateWin32(_GLFWwindow* window)
+{
+    // Window updates are applied immediately by the window manager
+}
+
 float _glfwGetWindowOpacityWin32(_GLFWwindow* window)
 {
     BYTE alpha;
@@ -3052,6 +3069,26 @@ void _glfwWaitEventsTimeoutWin32(double timeout)
     _glfwPollEventsWin32();
 }
 
+void _glfwWaitEventsUntilWin32(uint64_t deadline)
+{
+    const uint64_t now = _glfwPlatformGetTimerValue();
+    const uint64_t frequency = _glfwPlatformGetTimerFrequency();
+
+    if (deadline > now)
+    {
+        // Round up so the wait does not end before the deadline
+        uint64_t milliseconds =
+            (deadline - now) / frequency * 1000 +
+            ((deadline - now) % frequency * 1000 + frequency - 1) / frequency;
+        if (milliseconds >= INFINITE)
+            milliseconds = INFINITE - 1;
+
+        MsgWaitForMultipleObjects(0, NULL, FALSE, (DWORD) milliseconds, QS_ALLINPUT);
+    }
+
+    _glfwPollEventsWin32();
+}
+
 void _glfwPostEmptyEventWin32(void)
 {
     PostMessageW(_glfw.win32.helperWindowHandle, WM_NULL, 0, 0);
@@ -3381,12 +3418,14 @@ void _glfwGetRequiredInstanceExtensionsWin32(char** extensions)
 
 GLFWbool _glfwGetPhysicalDevicePresentationSupportWin32(VkInstance instance,
                                                         VkPhysicalDevice device,
-                                                        uint32_t queuefamily)
+                                                        uint32_t first,
+                                                        uint32_t count,
+                                                        int* supported)
 {
     PFN_vkGetPhysicalDeviceWin32PresentationSupportKHR
         vkGetPhysicalDeviceWin32PresentationSupportKHR =
         (PFN_vkGetPhysicalDeviceWin32PresentationSupportKHR)
-        vkGetInstanceProcAddr(instance, "vkGetPhysicalDeviceWin32PresentationSupportKHR");
+        _glfwGetCachedInstanceProc(instance, "vkGetPhysicalDeviceWin32PresentationSupportKHR");
     if (!vkGetPhysicalDeviceWin32PresentationSupportKHR)
     {
         _glfwInputError(GLFW_API_UNAVAILABLE,
@@ -3394,7 +3433,14 @@ GLFWbool _glfwGetPhysicalDevicePresentationSupportWin32(VkInstance instance,
         return GLFW_FALSE;
     }
 
-    return vkGetPhysicalDeviceWin32PresentationSupportKHR(device, queuefamily);
+    for (uint32_t i = 0;  i < count;  i++)
+    {
+        supported[i] =
+            vkGetPhysicalDeviceWin32PresentationSupportKHR(device, first + i) ?
+            GLFW_TRUE : GLFW_FALSE;
+    }
+
+    return GLFW_TRUE;
 }
 
 VkResult _glfwCreateWindowSurfaceWin32(VkInstance instance,
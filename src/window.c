@@ -34,6 +34,118 @@
 #include <float.h>
 
 
+#if defined(GLFW_BUILD_POSIX_POLL)
+
+// Updates the poll array entry of the specified application file descriptor
+//
+static void setEventPollFd(int index)
+{
+    const _GLFWeventfd* entry = _glfw.eventFds + index;
+    struct pollfd* pfd = _glfw.eventPollFds + _GLFW_POLL_PLATFORM_FDS + index;
+
+    pfd->fd = entry->fd;
+    pfd->events = 0;
+    pfd->revents = 0;
+
+    if (entry->events & GLFW_EVENT_FD_READ)
+        pfd->events |= POLLIN;
+    if (entry->events & GLFW_EVENT_FD_WRITE)
+        pfd->events |= POLLOUT;
+}
+
+#endif // GLFW_BUILD_POSIX_POLL
+
+// Retrieves the earliest deadline of any armed timer
+//
+static GLFWbool getNextTimerDeadline(uint64_t* deadline)
+{
+    GLFWbool found = GLFW_FALSE;
+
+    for (_GLFWtimer* timer = _glfw.timerListHead;  timer;  timer = timer->next)
+    {
+        if (timer->deadline && (!found || timer->deadline < *deadline))
+        {
+            *deadline = timer->deadline;
+            found = GLFW_TRUE;
+        }
+    }
+
+    return found;
+}
+
+// Calls the callbacks of all timers whose deadline has passed
+//
+static void dispatchTimers(void)
+{
+    const uint64_t now = _glfwPlatformGetTimerValue();
+    _GLFWtimer* timer = _glfw.timerListHead;
+
+    while (timer)
+    {
+        if (!timer->deadline || timer->deadline > now)
+        {
+            timer = timer->next;
+            continue;
+        }
+
+        if (timer->repeat)
+        {
+            // Skip any periods that were missed instead of firing them in
+            // a burst, while keeping the timer in phase
+            timer->deadline += timer->interval *
+                ((now - timer->deadline) / timer->interval + 1);
+        }
+        else
+            timer->deadline = 0;
+
+        timer->callback((GLFWtimer*) timer, timer->userPointer);
+
+        // The callback may have created or destroyed timers, so start over
+        // Each timer that fired is either disarmed or due after now
+        timer = _glfw.timerListHead;
+    }
+}
+
+// Waits for events until the specified deadline or the next timer deadline,
+// whichever comes first, then calls the callbacks of any expired timers
+//
+static void waitEventsUntil(uint64_t deadline)
+{
+    uint64_t timerDeadline;
+    if (getNextTimerDeadline(&timerDeadline) && timerDeadline < deadline)
+        deadline = timerDeadline;
+
+    _glfw.platform.waitEventsUntil(deadline);
+    dispatchTimers();
+}
+
+// Returns the refresh period of the monitor of the window, in timer ticks
+//
+static uint64_t getRefreshPeriod(_GLFWwindow* window)
+{
+    // Full screen windows use their monitor and windowed mode windows use the
+    // primary monitor, as window position is not available everywhere
+    _GLFWmonitor* monitor = window->monitor;
+    if (!monitor && _glfw.monitorCount)
+        monitor = _glfw.monitors[0];
+
+    int refreshRate = 0;
+    if (monitor && _glfw.platform.getVideoMode(monitor, &monitor->currentMode))
+        refreshRate = monitor->currentMode.refreshRate;
+    if (refreshRate <= 0)
+        refreshRate = 60;
+
+    return _glfwPlatformGetTimerFrequency() / refreshRate;
+}
+
+static void resetSwapStatistics(_GLFWwindow* window)
+{
+    memset(&window->swapStats, 0, sizeof(window->swapStats));
+    window->lastSwap = 0;
+    window->swapPeriod = getRefreshPeriod(window);
+}
+
+
 //////////////////////////////////////////////////////////////////////////
 //////                         GLFW event API                       //////
 //////////////////////////////////////////////////////////////////////////
@@ -153,6 +265,22 @@ void _glfwInputWindowDamage(_GLFWwindow* window)
         window->callbacks.refresh((GLFWwindow*) window);
 }
 
+// Notifies shared code that a swapped buffer of a window was presented
+// The time is specified as a timer value
+//
+void _glfwInputSwapComplete(_GLFWwindow* window, uint64_t time, uint64_t sequence)
+{
+    assert(window != NULL);
+
+    if (window->callbacks.swapComplete)
+    {
+        const double seconds = (double) (int64_t) (time - _glfw.timer.offset) /
+            _glfwPlatformGetTimerFrequency();
+
+        window->callbacks.swapComplete((GLFWwindow*) window, seconds, sequence);
+    }
+}
+
 // Notifies shared code that the user wishes to close a window
 //
 void _glfwInputWindowCloseRequest(_GLFWwindow* window)
@@ -171,6 +299,27 @@ void _glfwInputWindowMonitor(_GLFWwindow* window, _GLFWmonitor* monitor)
 {
     assert(window != NULL);
     window->monitor = monitor;
+    // The refresh rate may differ, so restart frame pacing
+    window->framePeriod = 0;
+}
+
+// Notifies shared code that an application file descriptor is ready
+//
+void _glfwInputEventFd(int fd, int events)
+{
+    for (int i = 0;  i < _glfw.eventFdCount;  i++)
+    {
+        const _GLFWeventfd* entry = _glfw.eventFds + i;
+        if (entry->fd == fd)
+        {
+            // The error condition is always reported, as with poll(2)
+            events &= entry->events | GLFW_EVENT_FD_ERROR;
+            if (events)
+                entry->callback(fd, events, entry->userPointer);
+
+            return;
+        }
+    }
 }
 
 //////////////////////////////////////////////////////////////////////////
@@ -232,6 +381,7 @@ GLFWAPI GLFWwindow* glfwCreateWindow(int width, int height,
     window->floating         = wndconfig.floating;
     window->focusOnShow      = wndconfig.focusOnShow;
     window->mousePassthrough = wndconfig.mousePassthrough;
+    window->swapStatistics   = wndconfig.swapStatistics;
     window->cursorMode       = GLFW_CURSOR_NORMAL;
 
     window->doublebuffer = fbconfig.doublebuffer;
@@ -250,6 +400,18 @@ GLFWAPI GLFWwindow* glfwCreateWindow(int width, int height,
         return NULL;
     }
 
+    if (window->swapStatistics)
+        resetSwapStatistics(window);
+
+    if (wndconfig.presentThread && window->context.client != GLFW_NO_API)
+    {
+        if (!_glfwCreatePresentThread(window))
+        {
+            glfwDestroyWindow((GLFWwindow*) window);
+            return NULL;
+        }
+    }
+
     return (GLFWwindow*) window;
 }
 
@@ -398,6 +560,12 @@ GLFWAPI void glfwWindowHint(int hint, int value)
         case GLFW_MOUSE_PASSTHROUGH:
             _glfw.hints.window.mousePassthrough = value ? GLFW_TRUE : GLFW_FALSE;
             return;
+        case GLFW_SWAP_STATISTICS:
+            _glfw.hints.window.swapStatistics = value ? GLFW_TRUE : GLFW_FALSE;
+            return;
+        case GLFW_PRESENT_THREAD:
+            _glfw.hints.window.presentThread = value ? GLFW_TRUE : GLFW_FALSE;
+            return;
         case GLFW_CLIENT_API:
             _glfw.hints.context.client = value;
             return;
@@ -483,11 +651,34 @@ GLFWAPI void glfwDestroyWindow(GLFWwindow* handle)
     if (window == _glfwPlatformGetTls(&_glfw.contextSlot))
         glfwMakeContextCurrent(NULL);
 
-    _glfw.platform.destroyWindow(window);
+    // With lazy context release the context may still be current in the
+    // context creation API, in which case making no context current again
+    // releases it
+    if (window == _glfwPlatformGetTls(&_glfw.lazyContextSlot))
+        glfwMakeContextCurrent(NULL);
+
+    // Frames already captured are written before the window goes away
+    _glfwStopCapture(window);
+
+    // Any buffer swap still queued is performed before the context goes away
+    _glfwDestroyPresentThread(window);
+
+    if (window->contextOnly)
+    {
+        if (window->context.destroy)
+            window->context.destroy(window);
+    }
+    else
+        _glfw.platform.destroyWindow(window);
+
+    _glfwReleaseProcCache(window);
+    _glfwFreeContextExtensions(window);
 
     // Unlink window from global linked list
     {
         _GLFWwindow** prev = &_glfw.windowListHead;
+        if (window->contextOnly)
+            prev = &_glfw.contextListHead;
 
         while (*prev != window)
             prev = &((*prev)->next);
@@ -795,6 +986,36 @@ GLFWAPI void glfwSetWindowOpacity(GLFWwindow* handle, float opacity)
     _glfw.platform.setWindowOpacity(window, opacity);
 }
 
+GLFWAPI double glfwGetWindowFrameMargin(GLFWwindow* handle)
+{
+    _GLFW_REQUIRE_INIT_OR_RETURN(0.0);
+
+    _GLFWwindow* window = (_GLFWwindow*) handle;
+    assert(window != NULL);
+
+    return window->frameMargin / (double) _glfwPlatformGetTimerFrequency();
+}
+
+GLFWAPI void glfwSetWindowFrameMargin(GLFWwindow* handle, double margin)
+{
+    assert(margin == margin);
+    assert(margin >= 0.0);
+    assert(margin <= 1.0);
+
+    _GLFW_REQUIRE_INIT();
+
+    _GLFWwindow* window = (_GLFWwindow*) handle;
+    assert(window != NULL);
+
+    if (margin != margin || margin < 0.0 || margin > 1.0)
+    {
+        _glfwInputError(GLFW_INVALID_VALUE, "Invalid frame margin %f", margin);
+        return;
+    }
+
+    window->frameMargin = (uint64_t) (margin * _glfwPlatformGetTimerFrequency());
+}
+
 GLFWAPI void glfwIconifyWindow(GLFWwindow* handle)
 {
     _GLFW_REQUIRE_INIT();
@@ -900,6 +1121,10 @@ GLFWAPI int glfwGetWindowAttrib(GLFWwindow* handle, int attrib)
             return window->focusOnShow;
         case GLFW_MOUSE_PASSTHROUGH:
             return window->mousePassthrough;
+        case GLFW_SWAP_STATISTICS:
+            return window->swapStatistics;
+        case GLFW_PRESENT_THREAD:
+            return window->present != NULL;
         case GLFW_TRANSPARENT_FRAMEBUFFER:
             return _glfw.platform.framebufferTransparent(window);
         case GLFW_RESIZABLE:
@@ -981,11 +1206,49 @@ GLFWAPI void glfwSetWindowAttrib(GLFWwindow* handle, int attrib, int value)
             window->mousePassthrough = value;
             _glfw.platform.setWindowMousePassthrough(window, value);
             return;
+
+        case GLFW_SWAP_STATISTICS:
+            // The present thread records swaps while statistics are enabled
+            if (window->present)
+                _glfwWaitForPresent(window);
+
+            if (value && !window->swapStatistics)
+                resetSwapStatistics(window);
+            window->swapStatistics = value;
+            return;
     }
 
     _glfwInputError(GLFW_INVALID_ENUM, "Invalid window attribute 0x%08X", attrib);
 }
 
+GLFWAPI void glfwBeginWindowUpdate(GLFWwindow* handle)
+{
+    _GLFW_REQUIRE_INIT();
+
+    _GLFWwindow* window = (_GLFWwindow*) handle;
+    assert(window != NULL);
+
+    window->updateLevel++;
+}
+
+GLFWAPI void glfwEndWindowUpdate(GLFWwindow* handle)
+{
+    _GLFW_REQUIRE_INIT();
+
+    _GLFWwindow* window = (_GLFWwindow*) handle;
+    assert(window != NULL);
+
+    if (!window->updateLevel)
+    {
+        _glfwInputError(GLFW_INVALID_VALUE, "No window update is in progress");
+        return;
+    }
+
+    window->updateLevel--;
+    if (!window->updateLevel)
+        _glfw.platform.endWindowUpdate(window);
+}
+
 GLFWAPI GLFWmonitor* glfwGetWindowMonitor(GLFWwindow* handle)
 {
     _GLFW_REQUIRE_INIT_OR_RETURN(NULL);
@@ -1164,16 +1427,34 @@ GLFWAPI GLFWwindowcontentscalefun glfwSetWindowContentScaleCallback(GLFWwindow*
     return cbfun;
 }
 
+GLFWAPI GLFWswapcompletefun glfwSetSwapCompleteCallback(GLFWwindow* handle,
+                                                        GLFWswapcompletefun cbfun)
+{
+    _GLFW_REQUIRE_INIT_OR_RETURN(NULL);
+
+    _GLFWwindow* window = (_GLFWwindow*) handle;
+    assert(window != NULL);
+
+    _GLFW_SWAP(GLFWswapcompletefun, window->callbacks.swapComplete, cbfun);
+    return cbfun;
+}
+
 GLFWAPI void glfwPollEvents(void)
 {
     _GLFW_REQUIRE_INIT();
     _glfw.platform.pollEvents();
+    dispatchTimers();
 }
 
 GLFWAPI void glfwWaitEvents(void)
 {
     _GLFW_REQUIRE_INIT();
-    _glfw.platform.waitEvents();
+
+    uint64_t deadline;
+    if (getNextTimerDeadline(&deadline))
+        waitEventsUntil(deadline);
+    else
+        _glfw.platform.waitEvents();
 }
 
 GLFWAPI void glfwWaitEventsTimeout(double timeout)
@@ -1189,7 +1470,93 @@ GLFWAPI void glfwWaitEventsTimeout(double timeout)
         return;
     }
 
-    _glfw.platform.waitEventsTimeout(timeout);
+    if (_glfw.timerListHead)
+        waitEventsUntil(_glfwGetTimerDeadline(timeout));
+    else
+        _glfw.platform.waitEventsTimeout(timeout);
+}
+
+GLFWAPI void glfwWaitEventsUntil(uint64_t deadline)
+{
+    _GLFW_REQUIRE_INIT();
+    waitEventsUntil(deadline);
+}
+
+GLFWAPI void glfwWaitForNextFrame(GLFWwindow* handle)
+{
+    _GLFW_REQUIRE_INIT();
+
+    _GLFWwindow* window = (_GLFWwindow*) handle;
+    assert(window != NULL);
+
+    const uint64_t frequency = _glfwPlatformGetTimerFrequency();
+    uint64_t now = _glfwPlatformGetTimerValue();
+
+    if (!window->framePeriod || now > window->frameDeadline + window->framePeriod)
+    {
+        // Start a new frame sequence, either on the first call or after the
+        // application has fallen more than a frame behind
+        window->framePeriod = getRefreshPeriod(window);
+        window->frameDeadline = now;
+    }
+
+    // Skip any frames whose wake-up time has already passed
+    do
+        window->frameDeadline += window->framePeriod;
+    while (window->frameDeadline <= now + window->frameMargin);
+
+    const uint64_t wake = window->frameDeadline - window->frameMargin;
+    const uint64_t spin = frequency / 1000;
+
+    // Sleep in the event wait until shortly before the wake-up time, processing
+    // any events that arrive, then spin for the remainder as the scheduler may
+    // oversleep by more than the spin time
+    while (now + spin < wake)
+    {
+        waitEventsUntil(wake - spin);
+        now = _glfwPlatformGetTimerValue();
+    }
+
+    while (_glfwPlatformGetTimerValue() < wake)
+        ;
+
+    _glfw.platform.pollEvents();
+    dispatchTimers();
+}
+
+GLFWAPI int glfwGetSwapStatistics(GLFWwindow* handle, GLFWswapstats* stats)
+{
+    assert(stats != NULL);
+
+    memset(stats, 0, sizeof(GLFWswapstats));
+
+    _GLFW_REQUIRE_INIT_OR_RETURN(GLFW_FALSE);
+
+    _GLFWwindow* window = (_GLFWwindow*) handle;
+    assert(window != NULL);
+
+    if (!window->swapStatistics)
+        return GLFW_FALSE;
+
+    // The statistics are recorded by the present thread, if any
+    if (window->present)
+        _glfwWaitForPresent(window);
+
+    *stats = window->swapStats;
+    return GLFW_TRUE;
+}
+
+GLFWAPI void glfwResetSwapStatistics(GLFWwindow* handle)
+{
+    _GLFW_REQUIRE_INIT();
+
+    _GLFWwindow* window = (_GLFWwindow*) handle;
+    assert(window != NULL);
+
+    if (window->present)
+        _glfwWaitForPresent(window);
+
+    resetSwapStatistics(window);
 }
 
 GLFWAPI void glfwPostEmptyEvent(void)
@@ -1198,3 +1565,178 @@ GLFWAPI void glfwPostEmptyEvent(void)
     _glfw.platform.postEmptyEvent();
 }
 
+GLFWAPI int glfwAddEventFd(int fd, int events, GLFWeventfdfun callback, void* user)
+{
+    _GLFW_REQUIRE_INIT_OR_RETURN(GLFW_FALSE);
+    assert(fd >= 0);
+    assert(callback != NULL);
+
+    if (fd < 0)
+    {
+        _glfwInputError(GLFW_INVALID_VALUE, "Invalid file descriptor %i", fd);
+        return GLFW_FALSE;
+    }
+
+    if (!events || (events & ~(GLFW_EVENT_FD_READ | GLFW_EVENT_FD_WRITE)))
+    {
+        _glfwInputError(GLFW_INVALID_VALUE,
+                        "Invalid event file descriptor flags 0x%08X", events);
+        return GLFW_FALSE;
+    }
+
+#if defined(GLFW_BUILD_POSIX_POLL)
+    for (int i = 0;  i < _glfw.eventFdCount;  i++)
+    {
+        _GLFWeventfd* entry = _glfw.eventFds + i;
+        if (entry->fd == fd)
+        {
+            entry->events = events;
+            entry->callback = callback;
+            entry->userPointer = user;
+            setEventPollFd(i);
+            return GLFW_TRUE;
+        }
+    }
+
+    _GLFWeventfd* eventFds =
+        _glfw_realloc(_glfw.eventFds,
+                      sizeof(_GLFWeventfd) * (_glfw.eventFdCount + 1));
+    if (!eventFds)
+    {
+        _glfwInputError(GLFW_OUT_OF_MEMORY, NULL);
+        return GLFW_FALSE;
+    }
+
+    _glfw.eventFds = eventFds;
+
+    struct pollfd* pollFds =
+        _glfw_realloc(_glfw.eventPollFds,
+                      sizeof(struct pollfd) *
+                      (_GLFW_POLL_PLATFORM_FDS + _glfw.eventFdCount + 1));
+    if (!pollFds)
+    {
+        _glfwInputError(GLFW_OUT_OF_MEMORY, NULL);
+        return GLFW_FALSE;
+    }
+
+    _glfw.eventPollFds = pollFds;
+    _glfw.eventFds[_glfw.eventFdCount].fd = fd;
+    _glfw.eventFds[_glfw.eventFdCount].events = events;
+    _glfw.eventFds[_glfw.eventFdCount].callback = callback;
+    _glfw.eventFds[_glfw.eventFdCount].userPointer = user;
+    setEventPollFd(_glfw.eventFdCount);
+    _glfw.eventFdCount++;
+    return GLFW_TRUE;
+#else
+    _glfwInputError(GLFW_FEATURE_UNAVAILABLE,
+                    "Event file descriptors are not supported on this platform");
+    return GLFW_FALSE;
+#endif
+}
+
+GLFWAPI void glfwRemoveEventFd(int fd)
+{
+    _GLFW_REQUIRE_INIT();
+
+    for (int i = 0;  i < _glfw.eventFdCount;  i++)
+    {
+        if (_glfw.eventFds[i].fd == fd)
+        {
+            _glfw.eventFdCount--;
+            _glfw.eventFds[i] = _glfw.eventFds[_glfw.eventFdCount];
+
+#if defined(GLFW_BUILD_POSIX_POLL)
+            struct pollfd* pollFds = _glfw.eventPollFds + _GLFW_POLL_PLATFORM_FDS;
+            pollFds[i] = pollFds[_glfw.eventFdCount];
+
+            if (_glfw.eventFdCount == 0)
+            {
+                _glfw_free(_glfw.eventPollFds);
+                _glfw.eventPollFds = NULL;
+            }
+            else
+            {
+                // Shrinking the array cannot fail in any useful allocator, but
+                // keep the larger one if it does
+                pollFds = _glfw_realloc(_glfw.eventPollFds,
+                                        sizeof(struct pollfd) *
+                                        (_GLFW_POLL_PLATFORM_FDS + _glfw.eventFdCount));
+                if (pollFds)
+                    _glfw.eventPollFds = pollFds;
+            }
+#endif
+            return;
+        }
+    }
+
+    _glfwInputError(GLFW_INVALID_VALUE, "File descriptor %i has not been added", fd);
+}
+
+GLFWAPI GLFWtimer* glfwCreateTimer(double interval, int repeat,
+                                   GLFWtimerfun callback, void* user)
+{
+    _GLFW_REQUIRE_INIT_OR_RETURN(NULL);
+    assert(interval == interval);
+    assert(interval > 0.0);
+    assert(interval <= DBL_MAX);
+    assert(callback != NULL);
+
+    if (interval != interval || interval <= 0.0 || interval > DBL_MAX)
+    {
+        _glfwInputError(GLFW_INVALID_VALUE, "Invalid timer interval %f", interval);
+        return NULL;
+    }
+
+    if (!callback)
+    {
+        _glfwInputError(GLFW_INVALID_VALUE, "Invalid timer callback");
+        return NULL;
+    }
+
+    _GLFWtimer* timer = _glfw_calloc(1, sizeof(_GLFWtimer));
+    if (!timer)
+    {
+        _glfwInputError(GLFW_OUT_OF_MEMORY, NULL);
+        return NULL;
+    }
+
+    const double ticks = interval * (double) _glfwPlatformGetTimerFrequency();
+    if (ticks < 1.0)
+        timer->interval = 1;
+    else if (ticks >= (double) (UINT64_MAX / 2))
+        timer->interval = UINT64_MAX / 2;
+    else
+        timer->interval = (uint64_t) ticks;
+
+    timer->deadline = _glfwPlatformGetTimerValue() + timer->interval;
+    timer->repeat = repeat ? GLFW_TRUE : GLFW_FALSE;
+    timer->callback = callback;
+    timer->userPointer = user;
+
+    timer->next = _glfw.timerListHead;
+    _glfw.timerListHead = timer;
+
+    return (GLFWtimer*) timer;
+}
+
+GLFWAPI void glfwDestroyTimer(GLFWtimer* handle)
+{
+    _GLFW_REQUIRE_INIT();
+
+    _GLFWtimer* timer = (_GLFWtimer*) handle;
+
+    if (timer == NULL)
+        return;
+
+    // Unlink timer from global linked list
+    {
+        _GLFWtimer** prev = &_glfw.timerListHead;
+
+        while (*prev != timer)
+            prev = &((*prev)->next);
+
+        *prev = timer->next;
+    }
+
+    _glfw_free(timer);
+}
@@ -49,6 +49,7 @@
 #include "fractional-scale-v1-client-protocol.h"
 #include "xdg-activation-v1-client-protocol.h"
 #include "idle-inhibit-unstable-v1-client-protocol.h"
+#include "presentation-time-client-protocol.h"
 
 // NOTE: Versions of wayland-scanner prior to 1.17.91 named every global array of
 //       wl_interface pointers 'types', making it impossible to combine several unmodified
@@ -91,6 +92,10 @@
 #include "idle-inhibit-unstable-v1-client-protocol-code.h"
 #undef types
 
+#define types _glfw_presentation_time_types
+#include "presentation-time-client-protocol-code.h"
+#undef types
+
 static void wmBaseHandlePing(void* userData,
                              struct xdg_wm_base* wmBase,
                              uint32_t serial)
@@ -103,6 +108,18 @@ static const struct xdg_wm_base_listener wmBaseListener =
     wmBaseHandlePing
 };
 
+static void presentationHandleClockId(void* userData,
+                                      struct wp_presentation* presentation,
+                                      uint32_t clock)
+{
+    _glfw.wl.presentationClock = (clockid_t) clock;
+}
+
+static const struct wp_presentation_listener presentationListener =
+{
+    presentationHandleClockId
+};
+
 static void registryHandleGlobal(void* userData,
                                  struct wl_registry* registry,
                                  uint32_t name,
@@ -208,6 +225,16 @@ static void registryHandleGlobal(void* userData,
                              &wp_fractional_scale_manager_v1_interface,
                              1);
     }
+    else if (strcmp(interface, "wp_presentation") == 0)
+    {
+        _glfw.wl.presentation =
+            wl_registry_bind(registry, name,
+                             &wp_presentation_interface,
+                             1);
+        wp_presentation_add_listener(_glfw.wl.presentation,
+                                     &presentationListener,
+                                     NULL);
+    }
 }
 
 static void registryHandleGlobalRemove(void* userData,
@@ -427,6 +454,102 @@ static GLFWbool loadCursorTheme(void)
     return GLFW_TRUE;
 }
 
+// Reads events from the display into their queues as soon as they arrive and
+// wakes up the main thread, which dispatches them
+// The read is prepared against an always empty private queue, as preparing
+// against the default queue would require dispatching it from this thread
+//
+static void* eventThreadMain(void* user)
+{
+    enum { DISPLAY_FD, STOP_FD };
+    struct pollfd fds[] =
+    {
+        [DISPLAY_FD] = { wl_display_get_fd(_glfw.wl.display), POLLIN },
+        [STOP_FD] = { _glfw.wl.eventThread.stop.fds[0], POLLIN }
+    };
+
+    for (;;)
+    {
+        if (wl_display_prepare_read_queue(_glfw.wl.display,
+                                          _glfw.wl.eventThread.queue) != 0)
+        {
+            break;
+        }
+
+        if (!_glfwPollUntilPOSIX(fds, sizeof(fds) / sizeof(fds[0]), NULL) ||
+            (fds[STOP_FD].revents & POLLIN))
+        {
+            wl_display_cancel_read(_glfw.wl.display);
+            break;
+        }
+
+        if (fds[DISPLAY_FD].revents & POLLIN)
+        {
+            // The main thread will notice any error when it next flushes
+            if (wl_display_read_events(_glfw.wl.display) != 0)
+                break;
+
+            _glfwPostEmptyEventPOSIX(&_glfw.wl.emptyEvent);
+        }
+        else
+        {
+            wl_display_cancel_read(_glfw.wl.display);
+
+            if (fds[DISPLAY_FD].revents & (POLLERR | POLLHUP))
+                break;
+        }
+    }
+
+    // Wake up the main thread so it notices if the connection was lost
+    _glfwPostEmptyEventPOSIX(&_glfw.wl.emptyEvent);
+    return NULL;
+}
+
+static GLFWbool startEventThread(void)
+{
+    if (!_glfwCreateEmptyEventPOSIX(&_glfw.wl.eventThread.stop))
+        return GLFW_FALSE;
+
+    _glfw.wl.eventThread.queue = wl_display_create_queue(_glfw.wl.display);
+    if (!_glfw.wl.eventThread.queue)
+    {
+        _glfwInputError(GLFW_PLATFORM_ERROR,
+                        "Wayland: Failed to create event thread queue");
+        return GLFW_FALSE;
+    }
+
+    const int result = pthread_create(&_glfw.wl.eventThread.thread,
+                                      NULL, eventThreadMain, NULL);
+    if (result != 0)
+    {
+        _glfwInputError(GLFW_PLATFORM_ERROR,
+                        "Wayland: Failed to create event thread: %s",
+                        strerror(result));
+        return GLFW_FALSE;
+    }
+
+    _glfw.wl.eventThread.running = GLFW_TRUE;
+    return GLFW_TRUE;
+}
+
+static void stopEventThread(void)
+{
+    if (_glfw.wl.eventThread.running)
+    {
+        _glfwPostEmptyEventPOSIX(&_glfw.wl.eventThread.stop);
+        pthread_join(_glfw.wl.eventThread.thread, NULL);
+        _glfw.wl.eventThread.running = GLFW_FALSE;
+    }
+
+    if (_glfw.wl.eventThread.queue)
+    {
+        wl_event_queue_destroy(_glfw.wl.eventThread.queue);
+        _glfw.wl.eventThread.queue = NULL;
+    }
+
+    _glfwDestroyEmptyEventPOSIX(&_glfw.wl.eventThread.stop);
+}
+
 
 //////////////////////////////////////////////////////////////////////////
 //////                       GLFW platform API                      //////
@@ -475,6 +598,7 @@ GLFWbool _glfwConnectWayland(int platformID, _GLFWplatform* platform)
         .setGammaRamp = _glfwSetGammaRampWayland,
         .createWindow = _glfwCreateWindowWayland,
         .destroyWindow = _glfwDestroyWindowWayland,
+        .createSharedContext = _glfwCreateSharedContextWayland,
         .setWindowTitle = _glfwSetWindowTitleWayland,
         .setWindowIcon = _glfwSetWindowIconWayland,
         .getWindowPos = _glfwGetWindowPosWayland,
@@ -506,9 +630,11 @@ GLFWbool _glfwConnectWayland(int platformID, _GLFWplatform* platform)
         .setWindowFloating = _glfwSetWindowFloatingWayland,
         .setWindowOpacity = _glfwSetWindowOpacityWayland,
         .setWindowMousePassthrough = _glfwSetWindowMousePassthroughWayland,
+        .endWindowUpdate = _glfwEndWindowUpdateWayland,
         .pollEvents = _glfwPollEventsWayland,
         .waitEvents = _glfwWaitEventsWayland,
         .waitEventsTimeout = _glfwWaitEventsTimeoutWayland,
+        .waitEventsUntil = _glfwWaitEventsUntilWayland,
         .postEmptyEvent = _glfwPostEmptyEventWayland,
         .getEGLPlatform = _glfwGetEGLPlatformWayland,
         .getEGLNativeDisplay = _glfwGetEGLNativeDisplayWayland,
@@ -585,6 +711,12 @@ int _glfwInitWayland(void)
         _glfwPlatformGetModuleSymbol(_glfw.wl.client.handle, "wl_display_get_fd");
     _glfw.wl.client.display_prepare_read = (PFN_wl_display_prepare_read)
         _glfwPlatformGetModuleSymbol(_glfw.wl.client.handle, "wl_display_prepare_read");
+    _glfw.wl.client.display_prepare_read_queue = (PFN_wl_display_prepare_read_queue)
+        _glfwPlatformGetModuleSymbol(_glfw.wl.client.handle, "wl_display_prepare_read_queue");
+    _glfw.wl.client.display_create_queue = (PFN_wl_display_create_queue)
+        _glfwPlatformGetModuleSymbol(_glfw.wl.client.handle, "wl_display_create_queue");
+    _glfw.wl.client.event_queue_destroy = (PFN_wl_event_queue_destroy)
+        _glfwPlatformGetModuleSymbol(_glfw.wl.client.handle, "wl_event_queue_destroy");
     _glfw.wl.client.proxy_marshal = (PFN_wl_proxy_marshal)
         _glfwPlatformGetModuleSymbol(_glfw.wl.client.handle, "wl_proxy_marshal");
     _glfw.wl.client.proxy_add_listener = (PFN_wl_proxy_add_listener)
@@ -616,6 +748,9 @@ int _glfwInitWayland(void)
         !_glfw.wl.client.display_roundtrip ||
         !_glfw.wl.client.display_get_fd ||
         !_glfw.wl.client.display_prepare_read ||
+        !_glfw.wl.client.display_prepare_read_queue ||
+        !_glfw.wl.client.display_create_queue ||
+        !_glfw.wl.client.event_queue_destroy ||
         !_glfw.wl.client.proxy_marshal ||
         !_glfw.wl.client.proxy_add_listener ||
         !_glfw.wl.client.proxy_destroy ||
@@ -829,6 +964,23 @@ int _glfwInitWayland(void)
         }
     }
 
+    if (!_glfwCreateEmptyEventPOSIX(&_glfw.wl.emptyEvent))
+        return GLFW_FALSE;
+
+    _glfw.wl.feedbackLock = _glfw_calloc(1, sizeof(_GLFWmutex));
+    if (!_glfw.wl.feedbackLock)
+    {
+        _glfwInputError(GLFW_OUT_OF_MEMORY, NULL);
+        return GLFW_FALSE;
+    }
+
+    if (!_glfwPlatformCreateMutex(_glfw.wl.feedbackLock))
+        return GLFW_FALSE;
+
+    // The compositor reports the presentation clock if it supports presentation
+    // feedback and the monotonic clock is the most likely one
+    _glfw.wl.presentationClock = CLOCK_MONOTONIC;
+
     _glfw.wl.registry = wl_display_get_registry(_glfw.wl.display);
     wl_registry_add_listener(_glfw.wl.registry, &registryListener, NULL);
 
@@ -881,6 +1033,12 @@ int _glfwInitWayland(void)
     if (!loadCursorTheme())
         return GLFW_FALSE;
 
+    if (_glfw.hints.init.wl.eventThread)
+    {
+        if (!startEventThread())
+            return GLFW_FALSE;
+    }
+
     if (_glfw.wl.seat && _glfw.wl.dataDeviceManager)
     {
         _glfw.wl.dataDevice =
@@ -894,6 +1052,8 @@ int _glfwInitWayland(void)
 
 void _glfwTerminateWayland(void)
 {
+    stopEventThread();
+
     _glfwTerminateEGL();
     _glfwTerminateOSMesa();
 
@@ -988,6 +1148,14 @@ void _glfwTerminateWayland(void)
         xdg_activation_v1_destroy(_glfw.wl.activationManager);
     if (_glfw.wl.fractionalScaleManager)
         wp_fractional_scale_manager_v1_destroy(_glfw.wl.fractionalScaleManager);
+    if (_glfw.wl.presentation)
+        wp_presentation_destroy(_glfw.wl.presentation);
+
+    if (_glfw.wl.feedbackLock)
+    {
+        _glfwPlatformDestroyMutex(_glfw.wl.feedbackLock);
+        _glfw_free(_glfw.wl.feedbackLock);
+    }
     if (_glfw.wl.registry)
         wl_registry_destroy(_glfw.wl.registry);
     if (_glfw.wl.display)
@@ -1001,6 +1169,8 @@ void _glfwTerminateWayland(void)
     if (_glfw.wl.cursorTimerfd >= 0)
         close(_glfw.wl.cursorTimerfd);
 
+    _glfwDestroyEmptyEventPOSIX(&_glfw.wl.emptyEvent);
+
     _glfw_free(_glfw.wl.clipboardString);
 }
 
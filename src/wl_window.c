@@ -51,6 +51,7 @@
 #include "xdg-activation-v1-client-protocol.h"
 #include "idle-inhibit-unstable-v1-client-protocol.h"
 #include "fractional-scale-v1-client-protocol.h"
+#include "presentation-time-client-protocol.h"
 
 #define GLFW_BORDER_SIZE    4
 #define GLFW_CAPTION_HEIGHT 24
@@ -555,6 +556,107 @@ const struct wp_fractional_scale_v1_listener fractionalScaleListener =
     fractionalScaleHandlePreferredScale,
 };
 
+// Removes the specified presentation feedback from those outstanding for the
+// window and destroys it
+//
+static void releasePresentationFeedback(_GLFWwindow* window,
+                                        struct wp_presentation_feedback* feedback)
+{
+    _glfwPlatformLockMutex(_glfw.wl.feedbackLock);
+
+    for (size_t i = 0; i < window->wl.feedbackCount; i++)
+    {
+        if (window->wl.feedbacks[i] == feedback)
+        {
+            window->wl.feedbacks[i] =
+                window->wl.feedbacks[window->wl.feedbackCount - 1];
+            window->wl.feedbackCount--;
+            break;
+        }
+    }
+
+    _glfwPlatformUnlockMutex(_glfw.wl.feedbackLock);
+
+    wp_presentation_feedback_destroy(feedback);
+}
+
+static void presentationFeedbackHandleSyncOutput(void* userData,
+                                                 struct wp_presentation_feedback* feedback,
+                                                 struct wl_output* output)
+{
+}
+
+static void presentationFeedbackHandlePresented(void* userData,
+                                                struct wp_presentation_feedback* feedback,
+                                                uint32_t secondsHigh,
+                                                uint32_t secondsLow,
+                                                uint32_t nanoseconds,
+                                                uint32_t refresh,
+                                                uint32_t sequenceHigh,
+                                                uint32_t sequenceLow,
+                                                uint32_t flags)
+{
+    // Outstanding feedback is destroyed with its window, so the window is
+    // still alive when this is received
+    _GLFWwindow* window = userData;
+    releasePresentationFeedback(window, feedback);
+
+    const uint64_t seconds = ((uint64_t) secondsHigh << 32) | secondsLow;
+    const uint64_t sequence = ((uint64_t) sequenceHigh << 32) | sequenceLow;
+    const uint64_t time = _glfwClockToTimerValuePOSIX(_glfw.wl.presentationClock,
+                                                      seconds, nanoseconds);
+
+    _glfwInputSwapComplete(window, time, sequence);
+}
+
+static void presentationFeedbackHandleDiscarded(void* userData,
+                                                struct wp_presentation_feedback* feedback)
+{
+    _GLFWwindow* window = userData;
+    releasePresentationFeedback(window, feedback);
+}
+
+static const struct wp_presentation_feedback_listener presentationFeedbackListener =
+{
+    presentationFeedbackHandleSyncOutput,
+    presentationFeedbackHandlePresented,
+    presentationFeedbackHandleDiscarded
+};
+
+// Requests presentation feedback for the next commit of the window surface
+//
+void _glfwRequestPresentationFeedbackWayland(_GLFWwindow* window)
+{
+    _glfwPlatformLockMutex(_glfw.wl.feedbackLock);
+
+    if (window->wl.feedbackCount + 1 > window->wl.feedbackSize)
+    {
+        struct wp_presentation_feedback** feedbacks =
+            _glfw_realloc(window->wl.feedbacks,
+                          (window->wl.feedbackSize + 1) * sizeof(struct wp_presentation_feedback*));
+        if (!feedbacks)
+        {
+            _glfwPlatformUnlockMutex(_glfw.wl.feedbackLock);
+            _glfwInputError(GLFW_OUT_OF_MEMORY, NULL);
+            return;
+        }
+
+        window->wl.feedbacks = feedbacks;
+        window->wl.feedbackSize++;
+    }
+
+    struct wp_presentation_feedback* feedback =
+        wp_presentation_feedback(_glfw.wl.presentation, window->wl.surface);
+
+    wp_presentation_feedback_add_listener(feedback,
+                                          &presentationFeedbackListener,
+                                          window);
+
+    window->wl.feedbacks[window->wl.feedbackCount++] = feedback;
+
+    _glfwPlatformUnlockMutex(_glfw.wl.feedbackLock);
+}
+
 static void xdgToplevelHandleConfigure(void* userData,
                                        struct xdg_toplevel* toplevel,
                                        int32_t width,
@@ -1202,7 +1304,7 @@ static void inputText(_GLFWwindow* window, uint32_t scancode)
     }
 }
 
-static void handleEvents(double* timeout)
+static void handleEvents(const uint64_t* deadline)
 {
 #if defined(GLFW_BUILD_LINUX_JOYSTICK)
     if (_glfw.joysticksInitialized)
@@ -1210,10 +1312,11 @@ static void handleEvents(double* timeout)
 #endif
 
     GLFWbool event = GLFW_FALSE;
-    enum { DISPLAY_FD, KEYREPEAT_FD, CURSOR_FD, LIBDECOR_FD };
+    enum { DISPLAY_FD, EMPTY_FD, KEYREPEAT_FD, CURSOR_FD, LIBDECOR_FD };
     struct pollfd fds[] =
     {
         [DISPLAY_FD] = { wl_display_get_fd(_glfw.wl.display), POLLIN },
+        [EMPTY_FD] = { _glfw.wl.emptyEvent.fds[0], POLLIN },
         [KEYREPEAT_FD] = { _glfw.wl.keyRepeatTimerfd, POLLIN },
         [CURSOR_FD] = { _glfw.wl.cursorTimerfd, POLLIN },
         [LIBDECOR_FD] = { -1, POLLIN }
@@ -1222,19 +1325,34 @@ static void handleEvents(double* timeout)
     if (_glfw.wl.libdecor.context)
         fds[LIBDECOR_FD].fd = libdecor_get_fd(_glfw.wl.libdecor.context);
 
+    // The event thread reads the display and posts an empty event when it has
+    // queued events for us to dispatch
+    const GLFWbool threaded = _glfw.wl.eventThread.running;
+    if (threaded)
+        fds[DISPLAY_FD].fd = -1;
+
     while (!event)
     {
-        while (wl_display_prepare_read(_glfw.wl.display) != 0)
+        if (threaded)
         {
             if (wl_display_dispatch_pending(_glfw.wl.display) > 0)
                 return;
         }
+        else
+        {
+            while (wl_display_prepare_read(_glfw.wl.display) != 0)
+            {
+                if (wl_display_dispatch_pending(_glfw.wl.display) > 0)
+                    return;
+            }
+        }
 
         // If an error other than EAGAIN happens, we have likely been disconnected
         // from the Wayland session; try to handle that the best we can.
         if (!flushDisplay())
         {
-            wl_display_cancel_read(_glfw.wl.display);
+            if (!threaded)
+                wl_display_cancel_read(_glfw.wl.display);
 
             _GLFWwindow* window = _glfw.windowListHead;
             while (window)
@@ -1246,21 +1364,38 @@ static void handleEvents(double* timeout)
             return;
         }
 
-        if (!_glfwPollPOSIX(fds, sizeof(fds) / sizeof(fds[0]), timeout))
+        GLFWbool dispatched;
+
+        if (!_glfwPollEventFdsPOSIX(fds, sizeof(fds) / sizeof(fds[0]), deadline,
+                                    &dispatched))
         {
-            wl_display_cancel_read(_glfw.wl.display);
+            if (!threaded)
+                wl_display_cancel_read(_glfw.wl.display);
             return;
         }
 
+        // An application file descriptor callback counts as an event
+        if (dispatched)
+            event = GLFW_TRUE;
+
         if (fds[DISPLAY_FD].revents & POLLIN)
         {
             wl_display_read_events(_glfw.wl.display);
             if (wl_display_dispatch_pending(_glfw.wl.display) > 0)
                 event = GLFW_TRUE;
         }
-        else
+        else if (!threaded)
             wl_display_cancel_read(_glfw.wl.display);
 
+        if (fds[EMPTY_FD].revents & POLLIN)
+        {
+            _glfwDrainEmptyEventPOSIX(&_glfw.wl.emptyEvent);
+            if (threaded)
+                wl_display_dispatch_pending(_glfw.wl.display);
+
+            event = GLFW_TRUE;
+        }
+
         if (fds[KEYREPEAT_FD].revents & POLLIN)
         {
             uint64_t repeats;
@@ -2228,13 +2363,31 @@ void _glfwDestroyWindowWayland(_GLFWwindow* window)
     if (window->wl.egl.window)
         wl_egl_window_destroy(window->wl.egl.window);
 
+    // Any present thread of the window has already been stopped
+    for (size_t i = 0; i < window->wl.feedbackCount; i++)
+        wp_presentation_feedback_destroy(window->wl.feedbacks[i]);
+
     if (window->wl.surface)
         wl_surface_destroy(window->wl.surface);
 
     _glfw_free(window->wl.appId);
+    _glfw_free(window->wl.feedbacks);
     _glfw_free(window->wl.outputScales);
 }
 
+GLFWbool _glfwCreateSharedContextWayland(_GLFWwindow* window,
+                                         const _GLFWctxconfig* ctxconfig,
+                                         const _GLFWfbconfig* fbconfig)
+{
+    if (ctxconfig->source == GLFW_EGL_CONTEXT_API ||
+        ctxconfig->source == GLFW_NATIVE_CONTEXT_API)
+    {
+        return _glfwCreateContextEGL(window, ctxconfig, fbconfig);
+    }
+    else
+        return _glfwCreateContextOSMesa(window, ctxconfig, fbconfig);
+}
+
 void _glfwSetWindowTitleWayland(_GLFWwindow* window, const char* title)
 {
     if (window->wl.libdecor.frame)
@@ -2633,6 +2786,12 @@ void _glfwSetWindowMousePassthroughWayland(_GLFWwindow* window, GLFWbool enabled
         wl_surface_set_input_region(window->wl.surface, NULL);
 }
 
+void _glfwEndWindowUpdateWayland(_GLFWwindow* window)
+{
+    // Requests are already buffered until the display is flushed by event
+    // processing
+}
+
 float _glfwGetWindowOpacityWayland(_GLFWwindow* window)
 {
     return 1.f;
@@ -2656,8 +2815,8 @@ GLFWbool _glfwRawMouseMotionSupportedWayland(void)
 
 void _glfwPollEventsWayland(void)
 {
-    double timeout = 0.0;
-    handleEvents(&timeout);
+    const uint64_t deadline = 0;
+    handleEvents(&deadline);
 }
 
 void _glfwWaitEventsWayland(void)
@@ -2667,13 +2826,18 @@ void _glfwWaitEventsWayland(void)
 
 void _glfwWaitEventsTimeoutWayland(double timeout)
 {
-    handleEvents(&timeout);
+    const uint64_t deadline = _glfwGetTimerDeadline(timeout);
+    handleEvents(&deadline);
+}
+
+void _glfwWaitEventsUntilWayland(uint64_t deadline)
+{
+    handleEvents(&deadline);
 }
 
 void _glfwPostEmptyEventWayland(void)
 {
-    wl_display_sync(_glfw.wl.display);
-    flushDisplay();
+    _glfwPostEmptyEventPOSIX(&_glfw.wl.emptyEvent);
 }
 
 void _glfwGetCursorPosWayland(_GLFWwindow* window, double* xpos, double* ypos)
@@ -3237,22 +3401,31 @@ void _glfwGetRequiredInstanceExtensionsWayland(char** extensions)
 
 GLFWbool _glfwGetPhysicalDevicePresentationSupportWayland(VkInstance instance,
                                                           VkPhysicalDevice device,
-                                                          uint32_t queuefamily)
+                                                          uint32_t first,
+                                                          uint32_t count,
+                                                          int* supported)
 {
     PFN_vkGetPhysicalDeviceWaylandPresentationSupportKHR
         vkGetPhysicalDeviceWaylandPresentationSupportKHR =
         (PFN_vkGetPhysicalDeviceWaylandPresentationSupportKHR)
-        vkGetInstanceProcAddr(instance, "vkGetPhysicalDeviceWaylandPresentationSupportKHR");
+        _glfwGetCachedInstanceProc(instance, "vkGetPhysicalDeviceWaylandPresentationSupportKHR");
     if (!vkGetPhysicalDeviceWaylandPresentationSupportKHR)
     {
         _glfwInputError(GLFW_API_UNAVAILABLE,
                         "Wayland: Vulkan instance missing VK_KHR_wayland_surface extension");
-        return VK_NULL_HANDLE;
+        return GLFW_FALSE;
     }
 
-    return vkGetPhysicalDeviceWaylandPresentationSupportKHR(device,
-                                                            queuefamily,
-                                                            _glfw.wl.display);
+    for (uint32_t i = 0;  i < count;  i++)
+    {
+        supported[i] =
+            vkGetPhysicalDeviceWaylandPresentationSupportKHR(device,
+                                                             first + i,
+                                                             _glfw.wl.display) ?
+            GLFW_TRUE : GLFW_FALSE;
+    }
+
+    return GLFW_TRUE;
 }
 
 VkResult _glfwCreateWindowSurfaceWayland(VkInstance instance,
@@ -844,6 +844,9 @@ static GLFWbool initExtensions(void)
     {
         _glfw.x11.x11xcb.GetXCBConnection = (PFN_XGetXCBConnection)
             _glfwPlatformGetModuleSymbol(_glfw.x11.x11xcb.handle, "XGetXCBConnection");
+
+        if (_glfw.x11.x11xcb.GetXCBConnection)
+            _glfw.x11.x11xcb.connection = XGetXCBConnection(_glfw.x11.display);
     }
 
 #if defined(__CYGWIN__)
@@ -1046,37 +1049,6 @@ static Window createHelperWindow(void)
                          CWEventMask, &wa);
 }
 
-// Create the pipe for empty events without assumuing the OS has pipe2(2)
-//
-static GLFWbool createEmptyEventPipe(void)
-{
-    if (pipe(_glfw.x11.emptyEventPipe) != 0)
-    {
-        _glfwInputError(GLFW_PLATFORM_ERROR,
-                        "X11: Failed to create empty event pipe: %s",
-                        strerror(errno));
-        return GLFW_FALSE;
-    }
-
-    for (int i = 0; i < 2; i++)
-    {
-        const int sf = fcntl(_glfw.x11.emptyEventPipe[i], F_GETFL, 0);
-        const int df = fcntl(_glfw.x11.emptyEventPipe[i], F_GETFD, 0);
-
-        if (sf == -1 || df == -1 ||
-            fcntl(_glfw.x11.emptyEventPipe[i], F_SETFL, sf | O_NONBLOCK) == -1 ||
-            fcntl(_glfw.x11.emptyEventPipe[i], F_SETFD, df | FD_CLOEXEC) == -1)
-        {
-            _glfwInputError(GLFW_PLATFORM_ERROR,
-                            "X11: Failed to set flags for empty event pipe: %s",
-                            strerror(errno));
-            return GLFW_FALSE;
-        }
-    }
-
-    return GLFW_TRUE;
-}
-
 // X error handler
 //
 static int errorHandler(Display *display, XErrorEvent* event)
@@ -1206,6 +1178,7 @@ GLFWbool _glfwConnectX11(int platformID, _GLFWplatform* platform)
         .setGammaRamp = _glfwSetGammaRampX11,
         .createWindow = _glfwCreateWindowX11,
         .destroyWindow = _glfwDestroyWindowX11,
+        .createSharedContext = _glfwCreateSharedContextX11,
         .setWindowTitle = _glfwSetWindowTitleX11,
         .setWindowIcon = _glfwSetWindowIconX11,
         .getWindowPos = _glfwGetWindowPosX11,
@@ -1237,9 +1210,11 @@ GLFWbool _glfwConnectX11(int platformID, _GLFWplatform* platform)
         .setWindowFloating = _glfwSetWindowFloatingX11,
         .setWindowOpacity = _glfwSetWindowOpacityX11,
         .setWindowMousePassthrough = _glfwSetWindowMousePassthroughX11,
+        .endWindowUpdate = _glfwEndWindowUpdateX11,
         .pollEvents = _glfwPollEventsX11,
         .waitEvents = _glfwWaitEventsX11,
         .waitEventsTimeout = _glfwWaitEventsTimeoutX11,
+        .waitEventsUntil = _glfwWaitEventsUntilX11,
         .postEmptyEvent = _glfwPostEmptyEventX11,
         .getEGLPlatform = _glfwGetEGLPlatformX11,
         .getEGLNativeDisplay = _glfwGetEGLNativeDisplayX11,
@@ -1352,8 +1327,6 @@ int _glfwInitX11(void)
         _glfwPlatformGetModuleSymbol(_glfw.x11.xlib.handle, "XCreateWindow");
     _glfw.x11.xlib.DefineCursor = (PFN_XDefineCursor)
         _glfwPlatformGetModuleSymbol(_glfw.x11.xlib.handle, "XDefineCursor");
-    _glfw.x11.xlib.DeleteContext = (PFN_XDeleteContext)
-        _glfwPlatformGetModuleSymbol(_glfw.x11.xlib.handle, "XDeleteContext");
     _glfw.x11.xlib.DeleteProperty = (PFN_XDeleteProperty)
         _glfwPlatformGetModuleSymbol(_glfw.x11.xlib.handle, "XDeleteProperty");
     _glfw.x11.xlib.DestroyIC = (PFN_XDestroyIC)
@@ -1368,8 +1341,6 @@ int _glfwInitX11(void)
         _glfwPlatformGetModuleSymbol(_glfw.x11.xlib.handle, "XEventsQueued");
     _glfw.x11.xlib.FilterEvent = (PFN_XFilterEvent)
         _glfwPlatformGetModuleSymbol(_glfw.x11.xlib.handle, "XFilterEvent");
-    _glfw.x11.xlib.FindContext = (PFN_XFindContext)
-        _glfwPlatformGetModuleSymbol(_glfw.x11.xlib.handle, "XFindContext");
     _glfw.x11.xlib.Flush = (PFN_XFlush)
         _glfwPlatformGetModuleSymbol(_glfw.x11.xlib.handle, "XFlush");
     _glfw.x11.xlib.Free = (PFN_XFree)
@@ -1440,8 +1411,6 @@ int _glfwInitX11(void)
         _glfwPlatformGetModuleSymbol(_glfw.x11.xlib.handle, "XResizeWindow");
     _glfw.x11.xlib.ResourceManagerString = (PFN_XResourceManagerString)
         _glfwPlatformGetModuleSymbol(_glfw.x11.xlib.handle, "XResourceManagerString");
-    _glfw.x11.xlib.SaveContext = (PFN_XSaveContext)
-        _glfwPlatformGetModuleSymbol(_glfw.x11.xlib.handle, "XSaveContext");
     _glfw.x11.xlib.SelectInput = (PFN_XSelectInput)
         _glfwPlatformGetModuleSymbol(_glfw.x11.xlib.handle, "XSelectInput");
     _glfw.x11.xlib.SendEvent = (PFN_XSendEvent)
@@ -1510,8 +1479,6 @@ int _glfwInitX11(void)
         _glfwPlatformGetModuleSymbol(_glfw.x11.xlib.handle, "XrmGetResource");
     _glfw.x11.xrm.GetStringDatabase = (PFN_XrmGetStringDatabase)
         _glfwPlatformGetModuleSymbol(_glfw.x11.xlib.handle, "XrmGetStringDatabase");
-    _glfw.x11.xrm.UniqueQuark = (PFN_XrmUniqueQuark)
-        _glfwPlatformGetModuleSymbol(_glfw.x11.xlib.handle, "XrmUniqueQuark");
     _glfw.x11.xlib.UnregisterIMInstantiateCallback = (PFN_XUnregisterIMInstantiateCallback)
         _glfwPlatformGetModuleSymbol(_glfw.x11.xlib.handle, "XUnregisterIMInstantiateCallback");
     _glfw.x11.xlib.utf8LookupString = (PFN_Xutf8LookupString)
@@ -1524,11 +1491,10 @@ int _glfwInitX11(void)
 
     _glfw.x11.screen = DefaultScreen(_glfw.x11.display);
     _glfw.x11.root = RootWindow(_glfw.x11.display, _glfw.x11.screen);
-    _glfw.x11.context = XUniqueContext();
 
     getSystemContentScale(&_glfw.x11.contentScaleX, &_glfw.x11.contentScaleY);
 
-    if (!createEmptyEventPipe())
+    if (!_glfwCreateEmptyEventPOSIX(&_glfw.x11.emptyEvent))
         return GLFW_FALSE;
 
     if (!initExtensions())
@@ -1566,6 +1532,9 @@ void _glfwTerminateX11(void)
         _glfw.x11.helperWindowHandle = None;
     }
 
+    _glfw_free(_glfw.x11.windowTable.entries);
+    memset(&_glfw.x11.windowTable, 0, sizeof(_glfw.x11.windowTable));
+
     if (_glfw.x11.hiddenCursorHandle)
     {
         XFreeCursor(_glfw.x11.display, _glfw.x11.hiddenCursorHandle);
@@ -1646,11 +1615,7 @@ void _glfwTerminateX11(void)
         _glfw.x11.xlib.handle = NULL;
     }
 
-    if (_glfw.x11.emptyEventPipe[0] || _glfw.x11.emptyEventPipe[1])
-    {
-        close(_glfw.x11.emptyEventPipe[0]);
-        close(_glfw.x11.emptyEventPipe[1]);
-    }
+    _glfwDestroyEmptyEventPOSIX(&_glfw.x11.emptyEvent);
 }
 
 #endif // _GLFW_X11
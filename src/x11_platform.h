@@ -53,6 +53,7 @@
 #define GLX_VENDOR 1
 #define GLX_RGBA_BIT 0x00000001
 #define GLX_WINDOW_BIT 0x00000001
+#define GLX_PBUFFER_BIT 0x00000004
 #define GLX_DRAWABLE_TYPE 0x8010
 #define GLX_RENDER_TYPE 0x8011
 #define GLX_RGBA_TYPE 0x8014
@@ -71,6 +72,8 @@
 #define GLX_ACCUM_ALPHA_SIZE 17
 #define GLX_SAMPLES 0x186a1
 #define GLX_VISUAL_ID 0x800b
+#define GLX_PBUFFER_HEIGHT 0x8040
+#define GLX_PBUFFER_WIDTH 0x8041
 
 #define GLX_FRAMEBUFFER_SRGB_CAPABLE_ARB 0x20b2
 #define GLX_CONTEXT_DEBUG_BIT_ARB 0x00000001
@@ -90,13 +93,29 @@
 #define GLX_CONTEXT_RELEASE_BEHAVIOR_NONE_ARB 0
 #define GLX_CONTEXT_RELEASE_BEHAVIOR_FLUSH_ARB 0x2098
 #define GLX_CONTEXT_OPENGL_NO_ERROR_ARB 0x31b3
+#define GLX_BufferSwapComplete 1
+#define GLX_BUFFER_SWAP_COMPLETE_INTEL_MASK 0x04000000
 
 typedef XID GLXWindow;
+typedef XID GLXPbuffer;
 typedef XID GLXDrawable;
 typedef struct __GLXFBConfig* GLXFBConfig;
 typedef struct __GLXcontext* GLXContext;
 typedef void (*__GLXextproc)(void);
 
+typedef struct
+{
+    int type;
+    unsigned long serial;
+    Bool send_event;
+    Display* display;
+    int event_type;
+    GLXDrawable drawable;
+    int64_t ust;
+    int64_t msc;
+    int64_t sbc;
+} GLXBufferSwapComplete;
+
 typedef XClassHint* (* PFN_XAllocClassHint)(void);
 typedef XSizeHints* (* PFN_XAllocSizeHints)(void);
 typedef XWMHints* (* PFN_XAllocWMHints)(void);
@@ -113,7 +132,6 @@ typedef XIC (* PFN_XCreateIC)(XIM,...);
 typedef Region (* PFN_XCreateRegion)(void);
 typedef Window (* PFN_XCreateWindow)(Display*,Window,int,int,unsigned int,unsigned int,unsigned int,int,unsigned int,Visual*,unsigned long,XSetWindowAttributes*);
 typedef int (* PFN_XDefineCursor)(Display*,Window,Cursor);
-typedef int (* PFN_XDeleteContext)(Display*,XID,XContext);
 typedef int (* PFN_XDeleteProperty)(Display*,Window,Atom);
 typedef void (* PFN_XDestroyIC)(XIC);
 typedef int (* PFN_XDestroyRegion)(Region);
@@ -121,7 +139,6 @@ typedef int (* PFN_XDestroyWindow)(Display*,Window);
 typedef int (* PFN_XDisplayKeycodes)(Display*,int*,int*);
 typedef int (* PFN_XEventsQueued)(Display*,int);
 typedef Bool (* PFN_XFilterEvent)(XEvent*,Window);
-typedef int (* PFN_XFindContext)(Display*,XID,XContext,XPointer*);
 typedef int (* PFN_XFlush)(Display*);
 typedef int (* PFN_XFree)(void*);
 typedef int (* PFN_XFreeColormap)(Display*,Colormap);
@@ -159,7 +176,6 @@ typedef int (* PFN_XRaiseWindow)(Display*,Window);
 typedef Bool (* PFN_XRegisterIMInstantiateCallback)(Display*,void*,char*,char*,XIDProc,XPointer);
 typedef int (* PFN_XResizeWindow)(Display*,Window,unsigned int,unsigned int);
 typedef char* (* PFN_XResourceManagerString)(Display*);
-typedef int (* PFN_XSaveContext)(Display*,XID,XContext,const char*);
 typedef int (* PFN_XSelectInput)(Display*,Window,long);
 typedef Status (* PFN_XSendEvent)(Display*,Window,Bool,long,XEvent*);
 typedef int (* PFN_XSetClassHint)(Display*,Window,XClassHint*);
@@ -195,7 +211,6 @@ typedef void (* PFN_XrmDestroyDatabase)(XrmDatabase);
 typedef Bool (* PFN_XrmGetResource)(XrmDatabase,const char*,const char*,char**,XrmValue*);
 typedef XrmDatabase (* PFN_XrmGetStringDatabase)(const char*);
 typedef void (* PFN_XrmInitialize)(void);
-typedef XrmQuark (* PFN_XrmUniqueQuark)(void);
 typedef Bool (* PFN_XUnregisterIMInstantiateCallback)(Display*,void*,char*,char*,XIDProc,XPointer);
 typedef int (* PFN_Xutf8LookupString)(XIC,XKeyPressedEvent*,char*,int,KeySym*,Status*);
 typedef void (* PFN_Xutf8SetWMProperties)(Display*,Window,const char*,const char*,char**,int,XSizeHints*,XWMHints*,XClassHint*);
@@ -215,7 +230,6 @@ typedef void (* PFN_Xutf8SetWMProperties)(Display*,Window,const char*,const char
 #define XCreateRegion _glfw.x11.xlib.CreateRegion
 #define XCreateWindow _glfw.x11.xlib.CreateWindow
 #define XDefineCursor _glfw.x11.xlib.DefineCursor
-#define XDeleteContext _glfw.x11.xlib.DeleteContext
 #define XDeleteProperty _glfw.x11.xlib.DeleteProperty
 #define XDestroyIC _glfw.x11.xlib.DestroyIC
 #define XDestroyRegion _glfw.x11.xlib.DestroyRegion
@@ -223,7 +237,6 @@ typedef void (* PFN_Xutf8SetWMProperties)(Display*,Window,const char*,const char
 #define XDisplayKeycodes _glfw.x11.xlib.DisplayKeycodes
 #define XEventsQueued _glfw.x11.xlib.EventsQueued
 #define XFilterEvent _glfw.x11.xlib.FilterEvent
-#define XFindContext _glfw.x11.xlib.FindContext
 #define XFlush _glfw.x11.xlib.Flush
 #define XFree _glfw.x11.xlib.Free
 #define XFreeColormap _glfw.x11.xlib.FreeColormap
@@ -259,7 +272,6 @@ typedef void (* PFN_Xutf8SetWMProperties)(Display*,Window,const char*,const char
 #define XRegisterIMInstantiateCallback _glfw.x11.xlib.RegisterIMInstantiateCallback
 #define XResizeWindow _glfw.x11.xlib.ResizeWindow
 #define XResourceManagerString _glfw.x11.xlib.ResourceManagerString
-#define XSaveContext _glfw.x11.xlib.SaveContext
 #define XSelectInput _glfw.x11.xlib.SelectInput
 #define XSendEvent _glfw.x11.xlib.SendEvent
 #define XSetClassHint _glfw.x11.xlib.SetClassHint
@@ -294,7 +306,6 @@ typedef void (* PFN_Xutf8SetWMProperties)(Display*,Window,const char*,const char
 #define XrmDestroyDatabase _glfw.x11.xrm.DestroyDatabase
 #define XrmGetResource _glfw.x11.xrm.GetResource
 #define XrmGetStringDatabase _glfw.x11.xrm.GetStringDatabase
-#define XrmUniqueQuark _glfw.x11.xrm.UniqueQuark
 #define XUnregisterIMInstantiateCallback _glfw.x11.xlib.UnregisterIMInstantiateCallback
 #define Xutf8LookupString _glfw.x11.xlib.utf8LookupString
 #define Xutf8SetWMProperties _glfw.x11.xlib.utf8SetWMProperties
@@ -406,6 +417,9 @@ typedef void (*PFNGLXSWAPINTERVALEXTPROC)(Display*,GLXDrawable,int);
 typedef XVisualInfo* (*PFNGLXGETVISUALFROMFBCONFIGPROC)(Display*,GLXFBConfig);
 typedef GLXWindow (*PFNGLXCREATEWINDOWPROC)(Display*,GLXFBConfig,Window,const int*);
 typedef void (*PFNGLXDESTROYWINDOWPROC)(Display*,GLXWindow);
+typedef GLXPbuffer (*PFNGLXCREATEPBUFFERPROC)(Display*,GLXFBConfig,const int*);
+typedef void (*PFNGLXDESTROYPBUFFERPROC)(Display*,GLXPbuffer);
+typedef void (*PFNGLXSELECTEVENTPROC)(Display*,GLXDrawable,unsigned long);
 
 typedef int (*PFNGLXSWAPINTERVALMESAPROC)(int);
 typedef int (*PFNGLXSWAPINTERVALSGIPROC)(int);
@@ -425,6 +439,9 @@ typedef GLXContext (*PFNGLXCREATECONTEXTATTRIBSARBPROC)(Display*,GLXFBConfig,GLX
 #define glXGetVisualFromFBConfig _glfw.glx.GetVisualFromFBConfig
 #define glXCreateWindow _glfw.glx.CreateWindow
 #define glXDestroyWindow _glfw.glx.DestroyWindow
+#define glXCreatePbuffer _glfw.glx.CreatePbuffer
+#define glXDestroyPbuffer _glfw.glx.DestroyPbuffer
+#define glXSelectEvent _glfw.glx.SelectEvent
 
 typedef VkFlags VkXlibSurfaceCreateFlagsKHR;
 typedef VkFlags VkXcbSurfaceCreateFlagsKHR;
@@ -453,7 +470,6 @@ typedef VkResult (APIENTRY *PFN_vkCreateXcbSurfaceKHR)(VkInstance,const VkXcbSur
 typedef VkBool32 (APIENTRY *PFN_vkGetPhysicalDeviceXcbPresentationSupportKHR)(VkPhysicalDevice,uint32_t,xcb_connection_t*,xcb_visualid_t);
 
 #include "xkb_unicode.h"
-#include "posix_poll.h"
 
 #define GLFW_X11_WINDOW_STATE           _GLFWwindowX11 x11;
 #define GLFW_X11_LIBRARY_WINDOW_STATE   _GLFWlibraryX11 x11;
@@ -470,6 +486,11 @@ typedef struct _GLFWcontextGLX
 {
     GLXContext      handle;
     GLXWindow       window;
+    GLXFBConfig     fbconfig;
+    // Drawable of a context without a window
+    GLXPbuffer      pbuffer;
+    // Whether swap complete events are selected for the window
+    GLFWbool        swapEvents;
 } _GLFWcontextGLX;
 
 // GLX-specific global data
@@ -482,6 +503,9 @@ typedef struct _GLFWlibraryGLX
 
     void*           handle;
 
+    // Usable GLXFBConfigs, enumerated on first use
+    _GLFWfbconfigcache* fbconfigs;
+
     // GLX 1.3 functions
     PFNGLXGETFBCONFIGSPROC              GetFBConfigs;
     PFNGLXGETFBCONFIGATTRIBPROC         GetFBConfigAttrib;
@@ -496,6 +520,9 @@ typedef struct _GLFWlibraryGLX
     PFNGLXGETVISUALFROMFBCONFIGPROC     GetVisualFromFBConfig;
     PFNGLXCREATEWINDOWPROC              CreateWindow;
     PFNGLXDESTROYWINDOWPROC             DestroyWindow;
+    PFNGLXCREATEPBUFFERPROC             CreatePbuffer;
+    PFNGLXDESTROYPBUFFERPROC            DestroyPbuffer;
+    PFNGLXSELECTEVENTPROC               SelectEvent;
 
     // GLX 1.4 and extension functions
     PFNGLXGETPROCADDRESSPROC            GetProcAddress;
@@ -516,6 +543,7 @@ typedef struct _GLFWlibraryGLX
     GLFWbool        EXT_create_context_es2_profile;
     GLFWbool        ARB_create_context_no_error;
     GLFWbool        ARB_context_flush_control;
+    GLFWbool        INTEL_swap_event;
 } _GLFWlibraryGLX;
 
 // X11-specific per-window data
@@ -528,8 +556,11 @@ typedef struct _GLFWwindowX11
     XIC             ic;
 
     GLFWbool        overrideRedirect;
+    // Cached state updated by window manager property changes
     GLFWbool        iconified;
     GLFWbool        maximized;
+    // Whether the cursor is over the window, updated by crossing events
+    GLFWbool        hovered;
 
     // Whether the visual supports framebuffer transparency
     GLFWbool        transparent;
@@ -537,11 +568,29 @@ typedef struct _GLFWwindowX11
     // Cached position and size used to filter out duplicate events
     int             width, height;
     int             xpos, ypos;
+    // The geometry last requested by GLFW, which is returned instead of the
+    // cached geometry until a ConfigureNotify generated after the request
+    // shows what the server made of it, or until the window is queried after
+    // the window manager has not answered the request in time
+    GLFWbool        geometryPending;
+    unsigned long   geometrySerial;
+    uint64_t        geometryTime;
+    int             requestedWidth, requestedHeight;
+    int             requestedXpos, requestedYpos;
 
     // The last received cursor position, regardless of source
     int             lastCursorPosX, lastCursorPosY;
     // The last position the cursor was warped to by GLFW
     int             warpCursorPosX, warpCursorPosY;
+    // The cursor position returned by glfwGetCursorPos while it is known to be
+    // up to date, i.e. while motion events are being received for the window
+    GLFWbool        cursorPosCached;
+    int             cachedCursorPosX, cachedCursorPosY;
+
+    // Updates deferred until the end of a window update
+    GLFWbool        titlePending;
+    GLFWbool        normalHintsPending;
+    int             normalHintsWidth, normalHintsHeight;
 
     // The time of the last KeyPress event per keycode, for discarding
     // duplicate key events generated for some keys by ibus
@@ -562,8 +611,12 @@ typedef struct _GLFWlibraryX11
     Window          helperWindowHandle;
     // Invisible cursor for hidden cursor mode
     Cursor          hiddenCursorHandle;
-    // Context for mapping window XIDs to _GLFWwindow pointers
-    XContext        context;
+    // Open addressing hash table mapping window XIDs to _GLFWwindow pointers
+    struct {
+        _GLFWwindow**   entries;
+        unsigned int    size;
+        unsigned int    count;
+    } windowTable;
     // XIM input method
     XIM             im;
     // The previous X error handler, to be restored later
@@ -584,7 +637,10 @@ typedef struct _GLFWlibraryX11
     double          restoreCursorPosX, restoreCursorPosY;
     // The window whose disabled cursor mode is active
     _GLFWwindow*    disabledCursorWindow;
-    int             emptyEventPipe[2];
+    // Wakes up the event wait for glfwPostEmptyEvent
+    _GLFWemptyEventPOSIX emptyEvent;
+    // The next request serial as of the last flush by event processing
+    unsigned long   flushedRequest;
 
     // Window manager atoms
     Atom            NET_SUPPORTED;
@@ -661,7 +717,6 @@ typedef struct _GLFWlibraryX11
         PFN_XCreateRegion CreateRegion;
         PFN_XCreateWindow CreateWindow;
         PFN_XDefineCursor DefineCursor;
-        PFN_XDeleteContext DeleteContext;
         PFN_XDeleteProperty DeleteProperty;
         PFN_XDestroyIC DestroyIC;
         PFN_XDestroyRegion DestroyRegion;
@@ -669,7 +724,6 @@ typedef struct _GLFWlibraryX11
         PFN_XDisplayKeycodes DisplayKeycodes;
         PFN_XEventsQueued EventsQueued;
         PFN_XFilterEvent FilterEvent;
-        PFN_XFindContext FindContext;
         PFN_XFlush Flush;
         PFN_XFree Free;
         PFN_XFreeColormap FreeColormap;
@@ -705,7 +759,6 @@ typedef struct _GLFWlibraryX11
         PFN_XRegisterIMInstantiateCallback RegisterIMInstantiateCallback;
         PFN_XResizeWindow ResizeWindow;
         PFN_XResourceManagerString ResourceManagerString;
-        PFN_XSaveContext SaveContext;
         PFN_XSelectInput SelectInput;
         PFN_XSendEvent SendEvent;
         PFN_XSetClassHint SetClassHint;
@@ -737,7 +790,6 @@ typedef struct _GLFWlibraryX11
         PFN_XrmDestroyDatabase DestroyDatabase;
         PFN_XrmGetResource GetResource;
         PFN_XrmGetStringDatabase GetStringDatabase;
-        PFN_XrmUniqueQuark UniqueQuark;
     } xrm;
 
     struct {
@@ -825,6 +877,8 @@ typedef struct _GLFWlibraryX11
     struct {
         void*       handle;
         PFN_XGetXCBConnection GetXCBConnection;
+        // The XCB connection of the display, retrieved once at initialization
+        xcb_connection_t* connection;
     } x11xcb;
 
     struct {
@@ -903,6 +957,7 @@ void _glfwTerminateX11(void);
 
 GLFWbool _glfwCreateWindowX11(_GLFWwindow* window, const _GLFWwndconfig* wndconfig, const _GLFWctxconfig* ctxconfig, const _GLFWfbconfig* fbconfig);
 void _glfwDestroyWindowX11(_GLFWwindow* window);
+GLFWbool _glfwCreateSharedContextX11(_GLFWwindow* window, const _GLFWctxconfig* ctxconfig, const _GLFWfbconfig* fbconfig);
 void _glfwSetWindowTitleX11(_GLFWwindow* window, const char* title);
 void _glfwSetWindowIconX11(_GLFWwindow* window, int count, const GLFWimage* images);
 void _glfwGetWindowPosX11(_GLFWwindow* window, int* xpos, int* ypos);
@@ -934,6 +989,7 @@ void _glfwSetWindowFloatingX11(_GLFWwindow* window, GLFWbool enabled);
 float _glfwGetWindowOpacityX11(_GLFWwindow* window);
 void _glfwSetWindowOpacityX11(_GLFWwindow* window, float opacity);
 void _glfwSetWindowMousePassthroughX11(_GLFWwindow* window, GLFWbool enabled);
+void _glfwEndWindowUpdateX11(_GLFWwindow* window);
 
 void _glfwSetRawMouseMotionX11(_GLFWwindow *window, GLFWbool enabled);
 GLFWbool _glfwRawMouseMotionSupportedX11(void);
@@ -941,6 +997,7 @@ GLFWbool _glfwRawMouseMotionSupportedX11(void);
 void _glfwPollEventsX11(void);
 void _glfwWaitEventsX11(void);
 void _glfwWaitEventsTimeoutX11(double timeout);
+void _glfwWaitEventsUntilX11(uint64_t deadline);
 void _glfwPostEmptyEventX11(void);
 
 void _glfwGetCursorPosX11(_GLFWwindow* window, double* xpos, double* ypos);
@@ -960,7 +1017,7 @@ EGLNativeDisplayType _glfwGetEGLNativeDisplayX11(void);
 EGLNativeWindowType _glfwGetEGLNativeWindowX11(_GLFWwindow* window);
 
 void _glfwGetRequiredInstanceExtensionsX11(char** extensions);
-GLFWbool _glfwGetPhysicalDevicePresentationSupportX11(VkInstance instance, VkPhysicalDevice device, uint32_t queuefamily);
+GLFWbool _glfwGetPhysicalDevicePresentationSupportX11(VkInstance instance, VkPhysicalDevice device, uint32_t first, uint32_t count, int* supported);
 VkResult _glfwCreateWindowSurfaceX11(VkInstance instance, _GLFWwindow* window, const VkAllocationCallbacks* allocator, VkSurfaceKHR* surface);
 
 void _glfwFreeMonitorX11(_GLFWmonitor* monitor);
@@ -56,6 +56,130 @@
 
 #define _GLFW_XDND_VERSION 5
 
+// Returns the home slot of the specified window XID in the window table
+//
+static unsigned int getWindowSlot(Window handle)
+{
+    // XIDs of one client share their high bits and are mostly sequential, so
+    // mix all bits with Fibonacci hashing before masking
+    const uint64_t hash = (uint64_t) handle * UINT64_C(0x9e3779b97f4a7c15);
+    return (unsigned int) (hash >> 32) & (_glfw.x11.windowTable.size - 1);
+}
+
+// Returns the window with the specified XID, or NULL if there is none
+//
+static _GLFWwindow* findWindow(Window handle)
+{
+    if (!_glfw.x11.windowTable.count)
+        return NULL;
+
+    const unsigned int mask = _glfw.x11.windowTable.size - 1;
+
+    for (unsigned int i = getWindowSlot(handle);  ;  i = (i + 1) & mask)
+    {
+        _GLFWwindow* window = _glfw.x11.windowTable.entries[i];
+        if (!window || window->x11.handle == handle)
+            return window;
+    }
+}
+
+// Adds the specified window to the window table, growing it as needed
+//
+static GLFWbool addWindowToTable(_GLFWwindow* window)
+{
+    // Keep the load factor at or below one half so probe sequences stay short
+    if ((_glfw.x11.windowTable.count + 1) * 2 > _glfw.x11.windowTable.size)
+    {
+        const unsigned int oldSize = _glfw.x11.windowTable.size;
+        _GLFWwindow** oldEntries = _glfw.x11.windowTable.entries;
+        const unsigned int size = oldSize ? oldSize * 2 : 16;
+
+        _GLFWwindow** entries = _glfw_calloc(size, sizeof(_GLFWwindow*));
+        if (!entries)
+        {
+            _glfwInputError(GLFW_OUT_OF_MEMORY, NULL);
+            return GLFW_FALSE;
+        }
+
+        _glfw.x11.windowTable.entries = entries;
+        _glfw.x11.windowTable.size = size;
+        _glfw.x11.windowTable.count = 0;
+
+        for (unsigned int i = 0;  i < oldSize;  i++)
+        {
+            if (oldEntries[i])
+                addWindowToTable(oldEntries[i]);
+        }
+
+        _glfw_free(oldEntries);
+    }
+
+    const unsigned int mask = _glfw.x11.windowTable.size - 1;
+    unsigned int i = getWindowSlot(window->x11.handle);
+
+    while (_glfw.x11.windowTable.entries[i])
+        i = (i + 1) & mask;
+
+    _glfw.x11.windowTable.entries[i] = window;
+    _glfw.x11.windowTable.count++;
+    return GLFW_TRUE;
+}
+
+// Removes the specified window from the window table
+//
+static void removeWindowFromTable(_GLFWwindow* window)
+{
+    if (!_glfw.x11.windowTable.count)
+        return;
+
+    const unsigned int mask = _glfw.x11.windowTable.size - 1;
+    unsigned int i = getWindowSlot(window->x11.handle);
+
+    while (_glfw.x11.windowTable.entries[i] != window)
+    {
+        if (!_glfw.x11.windowTable.entries[i])
+            return;
+
+        i = (i + 1) & mask;
+    }
+
+    // Shift back any later entries of the probe sequence into the hole, so
+    // lookups never need tombstones
+    for (unsigned int j = (i + 1) & mask;
+         _glfw.x11.windowTable.entries[j];
+         j = (j + 1) & mask)
+    {
+        const unsigned int home =
+            getWindowSlot(_glfw.x11.windowTable.entries[j]->x11.handle);
+
+        if (((j - home) & mask) >= ((j - i) & mask))
+        {
+            _glfw.x11.windowTable.entries[i] = _glfw.x11.windowTable.entries[j];
+            i = j;
+        }
+    }
+
+    _glfw.x11.windowTable.entries[i] = NULL;
+    _glfw.x11.windowTable.count--;
+}
+
+// Flushes the output buffer and reads any available event data like XPending,
+// counting the flush and, if the queue grew, the read
+//
+static int pendingEvents(void)
+{
+    const int queued = QLength(_glfw.x11.display);
+    const int count = XPending(_glfw.x11.display);
+
+    _glfw.x11.flushedRequest = NextRequest(_glfw.x11.display);
+    _glfw.counters.flushes++;
+
+    if (count > queued)
+        _glfw.counters.eventReads++;
+
+    return count;
+}
+
 // Wait for event data to arrive on the X11 display socket
 // This avoids blocking other threads via the per-display Xlib lock that also
 // covers GLX functions
@@ -64,7 +188,7 @@ static GLFWbool waitForX11Event(double* timeout)
 {
     struct pollfd fd = { ConnectionNumber(_glfw.x11.display), POLLIN };
 
-    while (!XPending(_glfw.x11.display))
+    while (!pendingEvents())
     {
         if (!_glfwPollPOSIX(&fd, 1, timeout))
             return GLFW_FALSE;
@@ -73,17 +197,18 @@ static GLFWbool waitForX11Event(double* timeout)
     return GLFW_TRUE;
 }
 
-// Wait for event data to arrive on any event file descriptor
+// Wait for event data to arrive on any event file descriptor, including those
+// added by the application
 // This avoids blocking other threads via the per-display Xlib lock that also
 // covers GLX functions
 //
-static GLFWbool waitForAnyEvent(double* timeout)
+static GLFWbool waitForAnyEvent(const uint64_t* deadline)
 {
-    enum { XLIB_FD, PIPE_FD, INOTIFY_FD };
+    enum { XLIB_FD, EMPTY_FD, INOTIFY_FD };
     struct pollfd fds[] =
     {
         [XLIB_FD] = { ConnectionNumber(_glfw.x11.display), POLLIN },
-        [PIPE_FD] = { _glfw.x11.emptyEventPipe[0], POLLIN },
+        [EMPTY_FD] = { _glfw.x11.emptyEvent.fds[0], POLLIN },
         [INOTIFY_FD] = { -1, POLLIN }
     };
 
@@ -92,45 +217,32 @@ static GLFWbool waitForAnyEvent(double* timeout)
         fds[INOTIFY_FD].fd = _glfw.linjs.inotify;
 #endif
 
-    while (!XPending(_glfw.x11.display))
+    // The output buffer is always flushed by XPending before blocking
+    while (!pendingEvents())
     {
-        if (!_glfwPollPOSIX(fds, sizeof(fds) / sizeof(fds[0]), timeout))
-            return GLFW_FALSE;
+        GLFWbool dispatched;
 
-        for (int i = 1; i < sizeof(fds) / sizeof(fds[0]); i++)
+        if (!_glfwPollEventFdsPOSIX(fds, sizeof(fds) / sizeof(fds[0]), deadline,
+                                    &dispatched))
         {
-            if (fds[i].revents & POLLIN)
-                return GLFW_TRUE;
+            return GLFW_FALSE;
         }
-    }
 
-    return GLFW_TRUE;
-}
+        // An application file descriptor callback counts as an event
+        if (dispatched)
+            return GLFW_TRUE;
 
-// Writes a byte to the empty event pipe
-//
-static void writeEmptyEvent(void)
-{
-    for (;;)
-    {
-        const char byte = 0;
-        const ssize_t result = write(_glfw.x11.emptyEventPipe[1], &byte, 1);
-        if (result == 1 || (result == -1 && errno != EINTR))
-            break;
-    }
-}
+        if (fds[EMPTY_FD].revents & POLLIN)
+        {
+            _glfwDrainEmptyEventPOSIX(&_glfw.x11.emptyEvent);
+            return GLFW_TRUE;
+        }
 
-// Drains available data from the empty event pipe
-//
-static void drainEmptyEvents(void)
-{
-    for (;;)
-    {
-        char dummy[64];
-        const ssize_t result = read(_glfw.x11.emptyEventPipe[0], dummy, sizeof(dummy));
-        if (result == -1 && errno != EINTR)
-            break;
+        if (fds[INOTIFY_FD].revents & POLLIN)
+            return GLFW_TRUE;
     }
+
+    return GLFW_TRUE;
 }
 
 // Waits until a VisibilityNotify event arrives for the specified window or the
@@ -177,6 +289,53 @@ static int getWindowState(_GLFWwindow* window)
     return result;
 }
 
+// Returns whether the window is maximized
+//
+static GLFWbool getWindowMaximized(_GLFWwindow* window)
+{
+    Atom* states;
+    GLFWbool maximized = GLFW_FALSE;
+
+    if (!_glfw.x11.NET_WM_STATE ||
+        !_glfw.x11.NET_WM_STATE_MAXIMIZED_VERT ||
+        !_glfw.x11.NET_WM_STATE_MAXIMIZED_HORZ)
+    {
+        return maximized;
+    }
+
+    const unsigned long count =
+        _glfwGetWindowPropertyX11(window->x11.handle,
+                                  _glfw.x11.NET_WM_STATE,
+                                  XA_ATOM,
+                                  (unsigned char**) &states);
+
+    for (unsigned long i = 0;  i < count;  i++)
+    {
+        if (states[i] == _glfw.x11.NET_WM_STATE_MAXIMIZED_VERT ||
+            states[i] == _glfw.x11.NET_WM_STATE_MAXIMIZED_HORZ)
+        {
+            maximized = GLFW_TRUE;
+            break;
+        }
+    }
+
+    if (states)
+        XFree(states);
+
+    return maximized;
+}
+
+// Returns the position of the content area of the window in root coordinates
+//
+static void getWindowPos(_GLFWwindow* window, int* xpos, int* ypos)
+{
+    Window dummy;
+
+    XTranslateCoordinates(_glfw.x11.display, window->x11.handle, _glfw.x11.root,
+                          0, 0, xpos, ypos, &dummy);
+    _glfw.counters.roundTrips++;
+}
+
 // Returns whether the event is a selection event
 //
 static Bool isSelectionEvent(Display* display, XEvent* event, XPointer pointer)
@@ -265,14 +424,90 @@ static void sendEventToWM(_GLFWwindow* window, Atom type,
                &event);
 }
 
-// Updates the normal hints according to the window settings
+// Sets the window title properties
 //
-static void updateNormalHints(_GLFWwindow* window, int width, int height)
+static void updateWindowTitle(_GLFWwindow* window, const char* title)
+{
+    if (_glfw.x11.xlib.utf8)
+    {
+        Xutf8SetWMProperties(_glfw.x11.display,
+                             window->x11.handle,
+                             title, title,
+                             NULL, 0,
+                             NULL, NULL, NULL);
+    }
+
+    XChangeProperty(_glfw.x11.display,  window->x11.handle,
+                    _glfw.x11.NET_WM_NAME, _glfw.x11.UTF8_STRING, 8,
+                    PropModeReplace,
+                    (unsigned char*) title, strlen(title));
+
+    XChangeProperty(_glfw.x11.display,  window->x11.handle,
+                    _glfw.x11.NET_WM_ICON_NAME, _glfw.x11.UTF8_STRING, 8,
+                    PropModeReplace,
+                    (unsigned char*) title, strlen(title));
+}
+
+// Records the position and size about to be requested for the window, which
+// are returned by queries until a ConfigureNotify shows the result
+//
+static void requestGeometry(_GLFWwindow* window,
+                            int xpos, int ypos,
+                            int width, int height)
+{
+    window->x11.geometryPending = GLFW_TRUE;
+    window->x11.geometrySerial = NextRequest(_glfw.x11.display);
+    window->x11.geometryTime = _glfwPlatformGetTimerValue();
+    window->x11.requestedXpos = xpos;
+    window->x11.requestedYpos = ypos;
+    window->x11.requestedWidth = width;
+    window->x11.requestedHeight = height;
+}
+
+// Returns whether the last geometry request for the window is still pending
+// A window manager may refuse or ignore the request without sending any
+// ConfigureNotify, so after half a second the window is queried instead
+//
+static GLFWbool isGeometryPending(_GLFWwindow* window)
+{
+    if (!window->x11.geometryPending)
+        return GLFW_FALSE;
+
+    const uint64_t elapsed = _glfwPlatformGetTimerValue() - window->x11.geometryTime;
+    if (elapsed < _glfwPlatformGetTimerFrequency() / 2)
+        return GLFW_TRUE;
+
+    window->x11.geometryPending = GLFW_FALSE;
+
+    XWindowAttributes attribs;
+    XGetWindowAttributes(_glfw.x11.display, window->x11.handle, &attribs);
+    _glfw.counters.roundTrips++;
+
+    window->x11.width = attribs.width;
+    window->x11.height = attribs.height;
+    getWindowPos(window, &window->x11.xpos, &window->x11.ypos);
+
+    return GLFW_FALSE;
+}
+
+// Flushes the requests made for the window unless a window update is in
+// progress, in which case glfwEndWindowUpdate does it
+//
+static void flushWindowRequests(_GLFWwindow* window)
+{
+    if (!window->updateLevel)
+        XFlush(_glfw.x11.display);
+}
+
+// Sends the normal hints according to the window settings
+//
+static void sendNormalHints(_GLFWwindow* window, int width, int height)
 {
     XSizeHints* hints = XAllocSizeHints();
 
     long supplied;
     XGetWMNormalHints(_glfw.x11.display, window->x11.handle, hints, &supplied);
+    _glfw.counters.roundTrips++;
 
     hints->flags &= ~(PMinSize | PMaxSize | PAspect);
 
@@ -316,6 +551,37 @@ static void updateNormalHints(_GLFWwindow* window, int width, int height)
     XFree(hints);
 }
 
+// Updates the normal hints according to the window settings
+//
+static void updateNormalHints(_GLFWwindow* window, int width, int height)
+{
+    // Only the last update during a window update needs to be sent
+    if (window->updateLevel)
+    {
+        window->x11.normalHintsPending = GLFW_TRUE;
+        window->x11.normalHintsWidth = width;
+        window->x11.normalHintsHeight = height;
+        return;
+    }
+
+    sendNormalHints(window, width, height);
+}
+
+// Sends the normal hints deferred by a window update in progress
+// This must be done before any request that changes the geometry or mapping of
+// the window, so the window manager does not apply it against stale hints
+//
+static void sendPendingNormalHints(_GLFWwindow* window)
+{
+    if (!window->x11.normalHintsPending)
+        return;
+
+    window->x11.normalHintsPending = GLFW_FALSE;
+    sendNormalHints(window,
+                    window->x11.normalHintsWidth,
+                    window->x11.normalHintsHeight);
+}
+
 // Updates the full screen status of the window
 //
 static void updateWindowMode(_GLFWwindow* window)
@@ -452,6 +718,18 @@ static char* convertLatin1toUTF8(const char* source)
     return target;
 }
 
+// Updates the cursor position returned by _glfwGetCursorPosX11
+//
+static void updateCachedCursorPos(_GLFWwindow* window, int x, int y)
+{
+    if (!_glfw.hints.init.x11.cursorPosCache)
+        return;
+
+    window->x11.cachedCursorPosX = x;
+    window->x11.cachedCursorPosY = y;
+    window->x11.cursorPosCached = GLFW_TRUE;
+}
+
 // Updates the cursor image according to its cursor mode
 //
 static void updateCursorImage(_GLFWwindow* window)
@@ -622,10 +900,8 @@ static GLFWbool createNativeWindow(_GLFWwindow* window,
         return GLFW_FALSE;
     }
 
-    XSaveContext(_glfw.x11.display,
-                 window->x11.handle,
-                 _glfw.x11.context,
-                 (XPointer) window);
+    if (!addWindowToTable(window))
+        return GLFW_FALSE;
 
     if (!wndconfig->decorated)
         _glfwSetWindowDecoratedX11(window, GLFW_FALSE);
@@ -781,8 +1057,14 @@ static GLFWbool createNativeWindow(_GLFWwindow* window,
         _glfwCreateInputContextX11(window);
 
     _glfwSetWindowTitleX11(window, wndconfig->title);
-    _glfwGetWindowPosX11(window, &window->x11.xpos, &window->x11.ypos);
-    _glfwGetWindowSizeX11(window, &window->x11.width, &window->x11.height);
+    getWindowPos(window, &window->x11.xpos, &window->x11.ypos);
+
+    XWindowAttributes attribs;
+    XGetWindowAttributes(_glfw.x11.display, window->x11.handle, &attribs);
+    _glfw.counters.roundTrips++;
+
+    window->x11.width = attribs.width;
+    window->x11.height = attribs.height;
 
     return GLFW_TRUE;
 }
@@ -1111,6 +1393,7 @@ static void acquireMonitor(_GLFWwindow* window)
         _glfwGetMonitorPosX11(window->monitor, &xpos, &ypos);
         _glfwGetVideoModeX11(window->monitor, &mode);
 
+        sendPendingNormalHints(window);
         XMoveResizeWindow(_glfw.x11.display, window->x11.handle,
                           xpos, ypos, mode.width, mode.height);
     }
@@ -1141,6 +1424,38 @@ static void releaseMonitor(_GLFWwindow* window)
     }
 }
 
+// Reports a buffer swap presented on the screen
+//
+static void handleBufferSwapComplete(const GLXBufferSwapComplete* event)
+{
+    // The drawable reported by libGL is usually the X11 window but may be the
+    // GLX window created for it
+    _GLFWwindow* window = findWindow(event->drawable);
+    if (!window)
+    {
+        for (window = _glfw.windowListHead;  window;  window = window->next)
+        {
+            if (window->context.source == GLFW_NATIVE_CONTEXT_API &&
+                window->context.client != GLFW_NO_API &&
+                window->context.glx.window == event->drawable)
+            {
+                break;
+            }
+        }
+
+        if (!window)
+            return;
+    }
+
+    // The UST of the swap is in microseconds of the monotonic clock
+    const uint64_t ust = (uint64_t) event->ust;
+    const uint64_t time = _glfwClockToTimerValuePOSIX(CLOCK_MONOTONIC,
+                                                      ust / 1000000,
+                                                      (ust % 1000000) * 1000);
+
+    _glfwInputSwapComplete(window, time, (uint64_t) event->msc);
+}
+
 // Process the specified X event
 //
 static void processEvent(XEvent *event)
@@ -1152,7 +1467,9 @@ static void processEvent(XEvent *event)
     if (event->type == KeyPress || event->type == KeyRelease)
         keycode = event->xkey.keycode;
 
-    filtered = XFilterEvent(event, None);
+    // Only input methods register event filters, so skip the call without one
+    if (_glfw.x11.im)
+        filtered = XFilterEvent(event, None);
 
     if (_glfw.x11.randr.available)
     {
@@ -1178,6 +1495,15 @@ static void processEvent(XEvent *event)
         }
     }
 
+    if (_glfw.glx.INTEL_swap_event)
+    {
+        if (event->type == _glfw.glx.eventBase + GLX_BufferSwapComplete)
+        {
+            handleBufferSwapComplete((GLXBufferSwapComplete*) event);
+            return;
+        }
+    }
+
     if (event->type == GenericEvent)
     {
         if (_glfw.x11.xi.available)
@@ -1222,11 +1548,8 @@ static void processEvent(XEvent *event)
         return;
     }
 
-    _GLFWwindow* window = NULL;
-    if (XFindContext(_glfw.x11.display,
-                     event->xany.window,
-                     _glfw.x11.context,
-                     (XPointer*) &window) != 0)
+    _GLFWwindow* window = findWindow(event->xany.window);
+    if (!window)
     {
         // This is an event for a window that has already been destroyed
         return;
@@ -1237,6 +1560,30 @@ static void processEvent(XEvent *event)
         case ReparentNotify:
         {
             window->x11.parent = event->xreparent.parent;
+
+            // Reparenting moves the window in root coordinates without any
+            // ConfigureNotify unless the window manager sends one
+            // The new parent may already have been destroyed by the time the
+            // event arrives
+            _glfwGrabErrorHandlerX11();
+
+            int xpos, ypos;
+            getWindowPos(window, &xpos, &ypos);
+
+            _glfwReleaseErrorHandlerX11();
+            if (_glfw.x11.errorCode == BadWindow)
+                return;
+
+            if (xpos != window->x11.xpos || ypos != window->x11.ypos)
+            {
+                window->x11.cursorPosCached = GLFW_FALSE;
+
+                window->x11.xpos = xpos;
+                window->x11.ypos = ypos;
+
+                _glfwInputWindowPos(window, xpos, ypos);
+            }
+
             return;
         }
 
@@ -1391,6 +1738,14 @@ static void processEvent(XEvent *event)
         {
             const int mods = translateState(event->xbutton.state);
 
+            // Releasing the implicit pointer grab outside the window ends the
+            // motion events that keep the cached position up to date
+            if (event->xbutton.x < 0 || event->xbutton.x >= window->x11.width ||
+                event->xbutton.y < 0 || event->xbutton.y >= window->x11.height)
+            {
+                window->x11.cursorPosCached = GLFW_FALSE;
+            }
+
             if (event->xbutton.button == Button1)
             {
                 _glfwInputMouseClick(window,
@@ -1436,16 +1791,24 @@ static void processEvent(XEvent *event)
             if (window->cursorMode == GLFW_CURSOR_HIDDEN)
                 updateCursorImage(window);
 
+            window->x11.hovered = GLFW_TRUE;
+
             _glfwInputCursorEnter(window, GLFW_TRUE);
             _glfwInputCursorPos(window, x, y);
 
             window->x11.lastCursorPosX = x;
             window->x11.lastCursorPosY = y;
+            updateCachedCursorPos(window, x, y);
             return;
         }
 
         case LeaveNotify:
         {
+            // Motion events are no longer received unless the pointer is
+            // grabbed, in which case the next one makes the cache valid again
+            window->x11.cursorPosCached = GLFW_FALSE;
+            window->x11.hovered = GLFW_FALSE;
+
             _glfwInputCursorEnter(window, GLFW_FALSE);
             return;
         }
@@ -1480,11 +1843,20 @@ static void processEvent(XEvent *event)
 
             window->x11.lastCursorPosX = x;
             window->x11.lastCursorPosY = y;
+            updateCachedCursorPos(window, x, y);
             return;
         }
 
         case ConfigureNotify:
         {
+            // The server has processed the last geometry request by the time
+            // it generated this event, so from now on the cache is current
+            if (window->x11.geometryPending &&
+                (long) (event->xany.serial - window->x11.geometrySerial) >= 0)
+            {
+                window->x11.geometryPending = GLFW_FALSE;
+            }
+
             if (event->xconfigure.width != window->x11.width ||
                 event->xconfigure.height != window->x11.height)
             {
@@ -1517,6 +1889,7 @@ static void processEvent(XEvent *event)
                                       xpos, ypos,
                                       &xpos, &ypos,
                                       &dummy);
+                _glfw.counters.roundTrips++;
 
                 _glfwReleaseErrorHandlerX11();
                 if (_glfw.x11.errorCode == BadWindow)
@@ -1525,6 +1898,9 @@ static void processEvent(XEvent *event)
 
             if (xpos != window->x11.xpos || ypos != window->x11.ypos)
             {
+                // The window moved relative to the cursor without a motion event
+                window->x11.cursorPosCached = GLFW_FALSE;
+
                 window->x11.xpos = xpos;
                 window->x11.ypos = ypos;
 
@@ -1817,7 +2193,7 @@ static void processEvent(XEvent *event)
             }
             else if (event->xproperty.atom == _glfw.x11.NET_WM_STATE)
             {
-                const GLFWbool maximized = _glfwWindowMaximizedX11(window);
+                const GLFWbool maximized = getWindowMaximized(window);
                 if (window->x11.maximized != maximized)
                 {
                     window->x11.maximized = maximized;
@@ -1833,6 +2209,63 @@ static void processEvent(XEvent *event)
     }
 }
 
+// Processes all events already received from the X server
+// The final flush is skipped when polling if no requests have been made
+// through Xlib since the last one
+//
+static void processPendingEvents(GLFWbool polling)
+{
+    // Skip the read if the wait already drained the empty event or none was
+    // posted, which is the common case
+    if (_glfwEmptyEventPendingPOSIX(&_glfw.x11.emptyEvent))
+        _glfwDrainEmptyEventPOSIX(&_glfw.x11.emptyEvent);
+
+#if defined(GLFW_BUILD_LINUX_JOYSTICK)
+    if (_glfw.joysticksInitialized)
+        _glfwDetectJoystickConnectionLinux();
+#endif
+
+    // Read all available event data once without flushing first, as any
+    // requests made before or while processing the events are flushed below
+    // Only calls that received new events are counted as reads
+    const int queued = QLength(_glfw.x11.display);
+    if (XEventsQueued(_glfw.x11.display, QueuedAfterReading) > queued)
+        _glfw.counters.eventReads++;
+
+    while (QLength(_glfw.x11.display))
+    {
+        XEvent event;
+        XNextEvent(_glfw.x11.display, &event);
+        processEvent(&event);
+        _glfw.counters.events++;
+    }
+
+    _GLFWwindow* window = _glfw.x11.disabledCursorWindow;
+    if (window)
+    {
+        int width, height;
+        _glfwGetWindowSizeX11(window, &width, &height);
+
+        // NOTE: Re-center the cursor only if it has moved since the last call,
+        //       to avoid breaking glfwWaitEvents with MotionNotify
+        if (window->x11.lastCursorPosX != width / 2 ||
+            window->x11.lastCursorPosY != height / 2)
+        {
+            _glfwSetCursorPosX11(window, width / 2, height / 2);
+        }
+    }
+
+    // NOTE: Requests queued by libGL or libEGL directly on the XCB connection
+    //       do not advance NextRequest, so the flush is only skipped when
+    //       polling, where the next call to a wait function flushes anyway
+    if (!polling || NextRequest(_glfw.x11.display) != _glfw.x11.flushedRequest)
+    {
+        XFlush(_glfw.x11.display);
+        _glfw.x11.flushedRequest = NextRequest(_glfw.x11.display);
+        _glfw.counters.flushes++;
+    }
+}
+
 
 //////////////////////////////////////////////////////////////////////////
 //////                       GLFW internal API                      //////
@@ -1862,6 +2295,7 @@ unsigned long _glfwGetWindowPropertyX11(Window window,
                        &itemCount,
                        &bytesAfter,
                        value);
+    _glfw.counters.roundTrips++;
 
     return itemCount;
 }
@@ -2063,7 +2497,7 @@ void _glfwDestroyWindowX11(_GLFWwindow* window)
 
     if (window->x11.handle)
     {
-        XDeleteContext(_glfw.x11.display, window->x11.handle, _glfw.x11.context);
+        removeWindowFromTable(window);
         XUnmapWindow(_glfw.x11.display, window->x11.handle);
         XDestroyWindow(_glfw.x11.display, window->x11.handle);
         window->x11.handle = (Window) 0;
@@ -2078,27 +2512,40 @@ void _glfwDestroyWindowX11(_GLFWwindow* window)
     XFlush(_glfw.x11.display);
 }
 
+GLFWbool _glfwCreateSharedContextX11(_GLFWwindow* window,
+                                     const _GLFWctxconfig* ctxconfig,
+                                     const _GLFWfbconfig* fbconfig)
+{
+    if (ctxconfig->source == GLFW_NATIVE_CONTEXT_API)
+        return _glfwCreateContextGLX(window, ctxconfig, fbconfig);
+    else if (ctxconfig->source == GLFW_EGL_CONTEXT_API)
+        return _glfwCreateContextEGL(window, ctxconfig, fbconfig);
+    else
+        return _glfwCreateContextOSMesa(window, ctxconfig, fbconfig);
+}
+
 void _glfwSetWindowTitleX11(_GLFWwindow* window, const char* title)
 {
-    if (_glfw.x11.xlib.utf8)
+    // Only the last title set during a window update needs to be sent
+    if (window->updateLevel)
     {
-        Xutf8SetWMProperties(_glfw.x11.display,
-                             window->x11.handle,
-                             title, title,
-                             NULL, 0,
-                             NULL, NULL, NULL);
+        window->x11.titlePending = GLFW_TRUE;
+        return;
     }
 
-    XChangeProperty(_glfw.x11.display,  window->x11.handle,
-                    _glfw.x11.NET_WM_NAME, _glfw.x11.UTF8_STRING, 8,
-                    PropModeReplace,
-                    (unsigned char*) title, strlen(title));
+    updateWindowTitle(window, title);
+    XFlush(_glfw.x11.display);
+}
 
-    XChangeProperty(_glfw.x11.display,  window->x11.handle,
-                    _glfw.x11.NET_WM_ICON_NAME, _glfw.x11.UTF8_STRING, 8,
-                    PropModeReplace,
-                    (unsigned char*) title, strlen(title));
+void _glfwEndWindowUpdateX11(_GLFWwindow* window)
+{
+    if (window->x11.titlePending)
+    {
+        window->x11.titlePending = GLFW_FALSE;
+        updateWindowTitle(window, window->title);
+    }
 
+    sendPendingNormalHints(window);
     XFlush(_glfw.x11.display);
 }
 
@@ -2149,25 +2596,32 @@ void _glfwSetWindowIconX11(_GLFWwindow* window, int count, const GLFWimage* imag
                         _glfw.x11.NET_WM_ICON);
     }
 
-    XFlush(_glfw.x11.display);
+    flushWindowRequests(window);
 }
 
 void _glfwGetWindowPosX11(_GLFWwindow* window, int* xpos, int* ypos)
 {
-    Window dummy;
-    int x, y;
-
-    XTranslateCoordinates(_glfw.x11.display, window->x11.handle, _glfw.x11.root,
-                          0, 0, &x, &y, &dummy);
-
-    if (xpos)
-        *xpos = x;
-    if (ypos)
-        *ypos = y;
+    // The position is kept up to date by ConfigureNotify and ReparentNotify
+    if (isGeometryPending(window))
+    {
+        if (xpos)
+            *xpos = window->x11.requestedXpos;
+        if (ypos)
+            *ypos = window->x11.requestedYpos;
+    }
+    else
+    {
+        if (xpos)
+            *xpos = window->x11.xpos;
+        if (ypos)
+            *ypos = window->x11.ypos;
+    }
 }
 
 void _glfwSetWindowPosX11(_GLFWwindow* window, int xpos, int ypos)
 {
+    sendPendingNormalHints(window);
+
     // HACK: Explicitly setting PPosition to any value causes some WMs, notably
     //       Compiz and Metacity, to honor the position of unmapped windows
     if (!_glfwWindowVisibleX11(window))
@@ -2186,19 +2640,31 @@ void _glfwSetWindowPosX11(_GLFWwindow* window, int xpos, int ypos)
         XFree(hints);
     }
 
+    int width, height;
+    _glfwGetWindowSizeX11(window, &width, &height);
+    requestGeometry(window, xpos, ypos, width, height);
+
     XMoveWindow(_glfw.x11.display, window->x11.handle, xpos, ypos);
-    XFlush(_glfw.x11.display);
+    flushWindowRequests(window);
 }
 
 void _glfwGetWindowSizeX11(_GLFWwindow* window, int* width, int* height)
 {
-    XWindowAttributes attribs;
-    XGetWindowAttributes(_glfw.x11.display, window->x11.handle, &attribs);
-
-    if (width)
-        *width = attribs.width;
-    if (height)
-        *height = attribs.height;
+    // The size is kept up to date by ConfigureNotify
+    if (isGeometryPending(window))
+    {
+        if (width)
+            *width = window->x11.requestedWidth;
+        if (height)
+            *height = window->x11.requestedHeight;
+    }
+    else
+    {
+        if (width)
+            *width = window->x11.width;
+        if (height)
+            *height = window->x11.height;
+    }
 }
 
 void _glfwSetWindowSizeX11(_GLFWwindow* window, int width, int height)
@@ -2210,13 +2676,18 @@ void _glfwSetWindowSizeX11(_GLFWwindow* window, int width, int height)
     }
     else
     {
+        int xpos, ypos;
+        _glfwGetWindowPosX11(window, &xpos, &ypos);
+        requestGeometry(window, xpos, ypos, width, height);
+
         if (!window->resizable)
             updateNormalHints(window, width, height);
 
+        sendPendingNormalHints(window);
         XResizeWindow(_glfw.x11.display, window->x11.handle, width, height);
     }
 
-    XFlush(_glfw.x11.display);
+    flushWindowRequests(window);
 }
 
 void _glfwSetWindowSizeLimitsX11(_GLFWwindow* window,
@@ -2226,7 +2697,7 @@ void _glfwSetWindowSizeLimitsX11(_GLFWwindow* window,
     int width, height;
     _glfwGetWindowSizeX11(window, &width, &height);
     updateNormalHints(window, width, height);
-    XFlush(_glfw.x11.display);
+    flushWindowRequests(window);
 }
 
 void _glfwSetWindowAspectRatioX11(_GLFWwindow* window, int numer, int denom)
@@ -2234,7 +2705,7 @@ void _glfwSetWindowAspectRatioX11(_GLFWwindow* window, int numer, int denom)
     int width, height;
     _glfwGetWindowSizeX11(window, &width, &height);
     updateNormalHints(window, width, height);
-    XFlush(_glfw.x11.display);
+    flushWindowRequests(window);
 }
 
 void _glfwGetFramebufferSizeX11(_GLFWwindow* window, int* width, int* height)
@@ -2323,7 +2794,7 @@ void _glfwIconifyWindowX11(_GLFWwindow* window)
     }
 
     XIconifyWindow(_glfw.x11.display, window->x11.handle, _glfw.x11.screen);
-    XFlush(_glfw.x11.display);
+    flushWindowRequests(window);
 }
 
 void _glfwRestoreWindowX11(_GLFWwindow* window)
@@ -2337,8 +2808,9 @@ void _glfwRestoreWindowX11(_GLFWwindow* window)
         return;
     }
 
-    if (_glfwWindowIconifiedX11(window))
+    if (getWindowState(window) == IconicState)
     {
+        sendPendingNormalHints(window);
         XMapWindow(_glfw.x11.display, window->x11.handle);
         waitForVisibilityNotify(window);
     }
@@ -2422,7 +2894,7 @@ void _glfwMaximizeWindowX11(_GLFWwindow* window)
                         missingCount);
     }
 
-    XFlush(_glfw.x11.display);
+    flushWindowRequests(window);
 }
 
 void _glfwShowWindowX11(_GLFWwindow* window)
@@ -2430,6 +2902,7 @@ void _glfwShowWindowX11(_GLFWwindow* window)
     if (_glfwWindowVisibleX11(window))
         return;
 
+    sendPendingNormalHints(window);
     XMapWindow(_glfw.x11.display, window->x11.handle);
     waitForVisibilityNotify(window);
 }
@@ -2437,7 +2910,7 @@ void _glfwShowWindowX11(_GLFWwindow* window)
 void _glfwHideWindowX11(_GLFWwindow* window)
 {
     XUnmapWindow(_glfw.x11.display, window->x11.handle);
-    XFlush(_glfw.x11.display);
+    flushWindowRequests(window);
 }
 
 void _glfwRequestWindowAttentionX11(_GLFWwindow* window)
@@ -2481,9 +2954,12 @@ void _glfwSetWindowMonitorX11(_GLFWwindow* window,
         }
         else
         {
+            requestGeometry(window, xpos, ypos, width, height);
+
             if (!window->resizable)
                 updateNormalHints(window, width, height);
 
+            sendPendingNormalHints(window);
             XMoveResizeWindow(_glfw.x11.display, window->x11.handle,
                               xpos, ypos, width, height);
         }
@@ -2506,6 +2982,7 @@ void _glfwSetWindowMonitorX11(_GLFWwindow* window,
     {
         if (!_glfwWindowVisibleX11(window))
         {
+            sendPendingNormalHints(window);
             XMapRaised(_glfw.x11.display, window->x11.handle);
             waitForVisibilityNotify(window);
         }
@@ -2516,6 +2993,8 @@ void _glfwSetWindowMonitorX11(_GLFWwindow* window,
     else
     {
         updateWindowMode(window);
+        requestGeometry(window, xpos, ypos, width, height);
+        sendPendingNormalHints(window);
         XMoveResizeWindow(_glfw.x11.display, window->x11.handle,
                           xpos, ypos, width, height);
     }
@@ -2529,81 +3008,34 @@ GLFWbool _glfwWindowFocusedX11(_GLFWwindow* window)
     int state;
 
     XGetInputFocus(_glfw.x11.display, &focused, &state);
+    _glfw.counters.roundTrips++;
     return window->x11.handle == focused;
 }
 
 GLFWbool _glfwWindowIconifiedX11(_GLFWwindow* window)
 {
-    return getWindowState(window) == IconicState;
+    // The state is kept up to date by PropertyNotify for WM_STATE
+    return window->x11.iconified;
 }
 
 GLFWbool _glfwWindowVisibleX11(_GLFWwindow* window)
 {
     XWindowAttributes wa;
     XGetWindowAttributes(_glfw.x11.display, window->x11.handle, &wa);
+    _glfw.counters.roundTrips++;
     return wa.map_state == IsViewable;
 }
 
 GLFWbool _glfwWindowMaximizedX11(_GLFWwindow* window)
 {
-    Atom* states;
-    GLFWbool maximized = GLFW_FALSE;
-
-    if (!_glfw.x11.NET_WM_STATE ||
-        !_glfw.x11.NET_WM_STATE_MAXIMIZED_VERT ||
-        !_glfw.x11.NET_WM_STATE_MAXIMIZED_HORZ)
-    {
-        return maximized;
-    }
-
-    const unsigned long count =
-        _glfwGetWindowPropertyX11(window->x11.handle,
-                                  _glfw.x11.NET_WM_STATE,
-                                  XA_ATOM,
-                                  (unsigned char**) &states);
-
-    for (unsigned long i = 0;  i < count;  i++)
-    {
-        if (states[i] == _glfw.x11.NET_WM_STATE_MAXIMIZED_VERT ||
-            states[i] == _glfw.x11.NET_WM_STATE_MAXIMIZED_HORZ)
-        {
-            maximized = GLFW_TRUE;
-            break;
-        }
-    }
-
-    if (states)
-        XFree(states);
-
-    return maximized;
+    // The state is kept up to date by PropertyNotify for _NET_WM_STATE
+    return window->x11.maximized;
 }
 
 GLFWbool _glfwWindowHoveredX11(_GLFWwindow* window)
 {
-    Window w = _glfw.x11.root;
-    while (w)
-    {
-        Window root;
-        int rootX, rootY, childX, childY;
-        unsigned int mask;
-
-        _glfwGrabErrorHandlerX11();
-
-        const Bool result = XQueryPointer(_glfw.x11.display, w,
-                                          &root, &w, &rootX, &rootY,
-                                          &childX, &childY, &mask);
-
-        _glfwReleaseErrorHandlerX11();
-
-        if (_glfw.x11.errorCode == BadWindow)
-            w = _glfw.x11.root;
-        else if (!result)
-            return GLFW_FALSE;
-        else if (w == window->x11.handle)
-            return GLFW_TRUE;
-    }
-
-    return GLFW_FALSE;
+    // The state is kept up to date by EnterNotify and LeaveNotify
+    return window->x11.hovered;
 }
 
 GLFWbool _glfwFramebufferTransparentX11(_GLFWwindow* window)
@@ -2611,6 +3043,7 @@ GLFWbool _glfwFramebufferTransparentX11(_GLFWwindow* window)
     if (!window->x11.transparent)
         return GLFW_FALSE;
 
+    _glfw.counters.roundTrips++;
     return XGetSelectionOwner(_glfw.x11.display, _glfw.x11.NET_WM_CM_Sx) != None;
 }
 
@@ -2707,7 +3140,7 @@ void _glfwSetWindowFloatingX11(_GLFWwindow* window, GLFWbool enabled)
             XFree(states);
     }
 
-    XFlush(_glfw.x11.display);
+    flushWindowRequests(window);
 }
 
 void _glfwSetWindowMousePassthroughX11(_GLFWwindow* window, GLFWbool enabled)
@@ -2781,58 +3214,52 @@ GLFWbool _glfwRawMouseMotionSupportedX11(void)
 
 void _glfwPollEventsX11(void)
 {
-    drainEmptyEvents();
-
-#if defined(GLFW_BUILD_LINUX_JOYSTICK)
-    if (_glfw.joysticksInitialized)
-        _glfwDetectJoystickConnectionLinux();
-#endif
-    XPending(_glfw.x11.display);
-
-    while (QLength(_glfw.x11.display))
+    // The wait functions check application file descriptors while waiting
+    if (_glfw.eventFdCount)
     {
-        XEvent event;
-        XNextEvent(_glfw.x11.display, &event);
-        processEvent(&event);
-    }
-
-    _GLFWwindow* window = _glfw.x11.disabledCursorWindow;
-    if (window)
-    {
-        int width, height;
-        _glfwGetWindowSizeX11(window, &width, &height);
-
-        // NOTE: Re-center the cursor only if it has moved since the last call,
-        //       to avoid breaking glfwWaitEvents with MotionNotify
-        if (window->x11.lastCursorPosX != width / 2 ||
-            window->x11.lastCursorPosY != height / 2)
-        {
-            _glfwSetCursorPosX11(window, width / 2, height / 2);
-        }
+        const uint64_t deadline = 0;
+        _glfwPollEventFdsPOSIX(NULL, 0, &deadline, NULL);
     }
 
-    XFlush(_glfw.x11.display);
+    processPendingEvents(GLFW_TRUE);
 }
 
 void _glfwWaitEventsX11(void)
 {
     waitForAnyEvent(NULL);
-    _glfwPollEventsX11();
+    processPendingEvents(GLFW_FALSE);
 }
 
 void _glfwWaitEventsTimeoutX11(double timeout)
 {
-    waitForAnyEvent(&timeout);
-    _glfwPollEventsX11();
+    const uint64_t deadline = _glfwGetTimerDeadline(timeout);
+    waitForAnyEvent(&deadline);
+    processPendingEvents(GLFW_FALSE);
+}
+
+void _glfwWaitEventsUntilX11(uint64_t deadline)
+{
+    waitForAnyEvent(&deadline);
+    processPendingEvents(GLFW_FALSE);
 }
 
 void _glfwPostEmptyEventX11(void)
 {
-    writeEmptyEvent();
+    _glfwPostEmptyEventPOSIX(&_glfw.x11.emptyEvent);
 }
 
 void _glfwGetCursorPosX11(_GLFWwindow* window, double* xpos, double* ypos)
 {
+    if (window->x11.cursorPosCached)
+    {
+        if (xpos)
+            *xpos = window->x11.cachedCursorPosX;
+        if (ypos)
+            *ypos = window->x11.cachedCursorPosY;
+
+        return;
+    }
+
     Window root, child;
     int rootX, rootY, childX, childY;
     unsigned int mask;
@@ -2841,6 +3268,7 @@ void _glfwGetCursorPosX11(_GLFWwindow* window, double* xpos, double* ypos)
                   &root, &child,
                   &rootX, &rootY, &childX, &childY,
                   &mask);
+    _glfw.counters.roundTrips++;
 
     if (xpos)
         *xpos = childX;
@@ -2857,6 +3285,20 @@ void _glfwSetCursorPosX11(_GLFWwindow* window, double x, double y)
     XWarpPointer(_glfw.x11.display, None, window->x11.handle,
                  0,0,0,0, (int) x, (int) y);
     XFlush(_glfw.x11.display);
+
+    // A warp outside the window would not be followed by any event telling us
+    // the cursor has moved on from there
+    if (window->x11.warpCursorPosX >= 0 &&
+        window->x11.warpCursorPosX < window->x11.width &&
+        window->x11.warpCursorPosY >= 0 &&
+        window->x11.warpCursorPosY < window->x11.height)
+    {
+        updateCachedCursorPos(window,
+                              window->x11.warpCursorPosX,
+                              window->x11.warpCursorPosY);
+    }
+    else
+        window->x11.cursorPosCached = GLFW_FALSE;
 }
 
 void _glfwSetCursorModeX11(_GLFWwindow* window, int mode)
@@ -3156,7 +3598,9 @@ void _glfwGetRequiredInstanceExtensionsX11(char** extensions)
 
 GLFWbool _glfwGetPhysicalDevicePresentationSupportX11(VkInstance instance,
                                                       VkPhysicalDevice device,
-                                                      uint32_t queuefamily)
+                                                      uint32_t first,
+                                                      uint32_t count,
+                                                      int* supported)
 {
     VisualID visualID = XVisualIDFromVisual(DefaultVisual(_glfw.x11.display,
                                                           _glfw.x11.screen));
@@ -3166,7 +3610,7 @@ GLFWbool _glfwGetPhysicalDevicePresentationSupportX11(VkInstance instance,
         PFN_vkGetPhysicalDeviceXcbPresentationSupportKHR
             vkGetPhysicalDeviceXcbPresentationSupportKHR =
             (PFN_vkGetPhysicalDeviceXcbPresentationSupportKHR)
-            vkGetInstanceProcAddr(instance, "vkGetPhysicalDeviceXcbPresentationSupportKHR");
+            _glfwGetCachedInstanceProc(instance, "vkGetPhysicalDeviceXcbPresentationSupportKHR");
         if (!vkGetPhysicalDeviceXcbPresentationSupportKHR)
         {
             _glfwInputError(GLFW_API_UNAVAILABLE,
@@ -3174,7 +3618,7 @@ GLFWbool _glfwGetPhysicalDevicePresentationSupportX11(VkInstance instance,
             return GLFW_FALSE;
         }
 
-        xcb_connection_t* connection = XGetXCBConnection(_glfw.x11.display);
+        xcb_connection_t* connection = _glfw.x11.x11xcb.connection;
         if (!connection)
         {
             _glfwInputError(GLFW_PLATFORM_ERROR,
@@ -3182,17 +3626,22 @@ GLFWbool _glfwGetPhysicalDevicePresentationSupportX11(VkInstance instance,
             return GLFW_FALSE;
         }
 
-        return vkGetPhysicalDeviceXcbPresentationSupportKHR(device,
-                                                            queuefamily,
-                                                            connection,
-                                                            visualID);
+        for (uint32_t i = 0;  i < count;  i++)
+        {
+            supported[i] =
+                vkGetPhysicalDeviceXcbPresentationSupportKHR(device,
+                                                             first + i,
+                                                             connection,
+                                                             visualID) ?
+                GLFW_TRUE : GLFW_FALSE;
+        }
     }
     else
     {
         PFN_vkGetPhysicalDeviceXlibPresentationSupportKHR
             vkGetPhysicalDeviceXlibPresentationSupportKHR =
             (PFN_vkGetPhysicalDeviceXlibPresentationSupportKHR)
-            vkGetInstanceProcAddr(instance, "vkGetPhysicalDeviceXlibPresentationSupportKHR");
+            _glfwGetCachedInstanceProc(instance, "vkGetPhysicalDeviceXlibPresentationSupportKHR");
         if (!vkGetPhysicalDeviceXlibPresentationSupportKHR)
         {
             _glfwInputError(GLFW_API_UNAVAILABLE,
@@ -3200,11 +3649,18 @@ GLFWbool _glfwGetPhysicalDevicePresentationSupportX11(VkInstance instance,
             return GLFW_FALSE;
         }
 
-        return vkGetPhysicalDeviceXlibPresentationSupportKHR(device,
-                                                             queuefamily,
-                                                             _glfw.x11.display,
-                                                             visualID);
+        for (uint32_t i = 0;  i < count;  i++)
+        {
+            supported[i] =
+                vkGetPhysicalDeviceXlibPresentationSupportKHR(device,
+                                                              first + i,
+                                                              _glfw.x11.display,
+                                                              visualID) ?
+                GLFW_TRUE : GLFW_FALSE;
+        }
     }
+
+    return GLFW_TRUE;
 }
 
 VkResult _glfwCreateWindowSurfaceX11(VkInstance instance,
@@ -3218,7 +3674,7 @@ VkResult _glfwCreateWindowSurfaceX11(VkInstance instance,
         VkXcbSurfaceCreateInfoKHR sci;
         PFN_vkCreateXcbSurfaceKHR vkCreateXcbSurfaceKHR;
 
-        xcb_connection_t* connection = XGetXCBConnection(_glfw.x11.display);
+        xcb_connection_t* connection = _glfw.x11.x11xcb.connection;
         if (!connection)
         {
             _glfwInputError(GLFW_PLATFORM_ERROR,
@@ -0,0 +1,142 @@
+//========================================================================
+// Context bring-up benchmark
+// Copyright (c) Camilla Löwy <elmindreda@glfw.org>
+//
+// This software is provided 'as-is', without any express or implied
+// warranty. In no event will the authors be held liable for any damages
+// arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it
+// freely, subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented; you must not
+//    claim that you wrote the original software. If you use this software
+//    in a product, an acknowledgment in the product documentation would
+//    be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such, and must not
+//    be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source
+//    distribution.
+//
+//========================================================================
+//
+// This test creates many hidden windows with OpenGL contexts, optionally
+// sharing objects with the first one, and measures the time taken to create
+// each context and to load its OpenGL functions with glad
+//
+// It is intended for software renderers like Mesa llvmpipe, where resolving
+// function pointers makes up a large part of the time needed to bring up
+// a context
+//
+//========================================================================
+
+#define GLAD_GL_IMPLEMENTATION
+#include <glad/gl.h>
+#define GLFW_INCLUDE_NONE
+#include <GLFW/glfw3.h>
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "getopt.h"
+
+static void usage(void)
+{
+    printf("Usage: contexts [-n CONTEXTS] [-s]\n");
+    printf("       contexts -h\n");
+}
+
+static void error_callback(int error, const char* description)
+{
+    fprintf(stderr, "Error: %s\n", description);
+}
+
+int main(int argc, char** argv)
+{
+    int ch, i, count = 16, share = GLFW_FALSE;
+    double create_time = 0.0, first_load_time = 0.0, load_time = 0.0;
+    GLFWwindow** windows;
+
+    while ((ch = getopt(argc, argv, "hn:s")) != -1)
+    {
+        switch (ch)
+        {
+            case 'h':
+                usage();
+                exit(EXIT_SUCCESS);
+            case 'n':
+                count = atoi(optarg);
+                break;
+            case 's':
+                share = GLFW_TRUE;
+                break;
+            default:
+                usage();
+                exit(EXIT_FAILURE);
+        }
+    }
+
+    if (count <= 0)
+    {
+        usage();
+        exit(EXIT_FAILURE);
+    }
+
+    glfwSetErrorCallback(error_callback);
+
+    if (!glfwInit())
+        exit(EXIT_FAILURE);
+
+    glfwWindowHint(GLFW_VISIBLE, GLFW_FALSE);
+
+    windows = calloc(count, sizeof(GLFWwindow*));
+
+    for (i = 0;  i < count;  i++)
+    {
+        double start = glfwGetTime();
+
+        windows[i] = glfwCreateWindow(64, 64, "Contexts", NULL,
+                                      share && i > 0 ? windows[0] : NULL);
+        if (!windows[i])
+        {
+            glfwTerminate();
+            exit(EXIT_FAILURE);
+        }
+
+        create_time += glfwGetTime() - start;
+
+        glfwMakeContextCurrent(windows[i]);
+
+        start = glfwGetTime();
+
+        if (!gladLoadGL(glfwGetProcAddress))
+        {
+            fprintf(stderr, "Failed to load OpenGL functions\n");
+            glfwTerminate();
+            exit(EXIT_FAILURE);
+        }
+
+        if (i == 0)
+            first_load_time = glfwGetTime() - start;
+        else
+            load_time += glfwGetTime() - start;
+    }
+
+    printf("Created %i %s contexts\n", count, share ? "sharing" : "separate");
+    printf("%.3f ms per context creation\n", create_time * 1e3 / count);
+    printf("%.3f ms for the first function load\n", first_load_time * 1e3);
+
+    if (count > 1)
+    {
+        printf("%.3f ms per later function load\n",
+               load_time * 1e3 / (count - 1));
+    }
+
+    free(windows);
+
+    glfwTerminate();
+    exit(EXIT_SUCCESS);
+}
@@ -0,0 +1,172 @@
+//========================================================================
+// Event dispatch benchmark
+// Copyright (c) Camilla Löwy <elmindreda@glfw.org>
+//
+// This software is provided 'as-is', without any express or implied
+// warranty. In no event will the authors be held liable for any damages
+// arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it
+// freely, subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented; you must not
+//    claim that you wrote the original software. If you use this software
+//    in a product, an acknowledgment in the product documentation would
+//    be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such, and must not
+//    be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source
+//    distribution.
+//
+//========================================================================
+//
+// This test creates many hidden windows and repeatedly changes their titles in
+// random order, which makes the window system send a property change event to
+// each window, then measures the time event processing takes per event
+//
+// It is intended for X11, including under Xvfb, where it uses the event
+// counters to know how many events were dispatched
+//
+//========================================================================
+
+#define GLFW_INCLUDE_NONE
+#include <GLFW/glfw3.h>
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "getopt.h"
+
+static void usage(void)
+{
+    printf("Usage: dispatch [-n WINDOWS] [-r ROUNDS]\n");
+    printf("       dispatch -h\n");
+}
+
+static void error_callback(int error, const char* description)
+{
+    fprintf(stderr, "Error: %s\n", description);
+}
+
+int main(int argc, char** argv)
+{
+    int ch, i, round, window_count = 500, round_count = 100;
+    double elapsed = 0.0;
+    uint64_t events = 0, reads = 0;
+    GLFWwindow** windows;
+    int* order;
+
+    while ((ch = getopt(argc, argv, "hn:r:")) != -1)
+    {
+        switch (ch)
+        {
+            case 'h':
+                usage();
+                exit(EXIT_SUCCESS);
+            case 'n':
+                window_count = atoi(optarg);
+                break;
+            case 'r':
+                round_count = atoi(optarg);
+                break;
+            default:
+                usage();
+                exit(EXIT_FAILURE);
+        }
+    }
+
+    if (window_count <= 0 || round_count <= 0)
+    {
+        usage();
+        exit(EXIT_FAILURE);
+    }
+
+    glfwSetErrorCallback(error_callback);
+
+    if (!glfwInit())
+        exit(EXIT_FAILURE);
+
+    glfwWindowHint(GLFW_CLIENT_API, GLFW_NO_API);
+    glfwWindowHint(GLFW_VISIBLE, GLFW_FALSE);
+
+    windows = calloc(window_count, sizeof(GLFWwindow*));
+    order = calloc(window_count, sizeof(int));
+
+    for (i = 0;  i < window_count;  i++)
+    {
+        windows[i] = glfwCreateWindow(64, 64, "Dispatch", NULL, NULL);
+        if (!windows[i])
+        {
+            glfwTerminate();
+            exit(EXIT_FAILURE);
+        }
+
+        order[i] = i;
+    }
+
+    printf("Created %i windows\n", window_count);
+
+    // Let the creation events settle before measuring
+    glfwWaitEventsTimeout(0.1);
+    glfwPollEvents();
+
+    for (round = 0;  round < round_count;  round++)
+    {
+        char title[64];
+        int idle = 0;
+
+        for (i = window_count - 1;  i > 0;  i--)
+        {
+            const int j = rand() % (i + 1);
+            const int temp = order[i];
+            order[i] = order[j];
+            order[j] = temp;
+        }
+
+        snprintf(title, sizeof(title), "Dispatch %i", round);
+
+        for (i = 0;  i < window_count;  i++)
+            glfwSetWindowTitle(windows[order[i]], title);
+
+        // Only polling is measured, as the events dispatched by the waits for
+        // more events to arrive are not counted
+        while (idle < 2)
+        {
+            glfwResetCounters();
+
+            const double start = glfwGetTime();
+            glfwPollEvents();
+            elapsed += glfwGetTime() - start;
+
+            const uint64_t count = glfwGetCounter(GLFW_COUNTER_EVENTS);
+            reads += glfwGetCounter(GLFW_COUNTER_EVENT_READS);
+            events += count;
+
+            if (count)
+                idle = 0;
+            else
+            {
+                idle++;
+                glfwWaitEventsTimeout(0.001);
+            }
+        }
+    }
+
+    if (events)
+    {
+        printf("Dispatched %llu events in %llu reads over %i rounds\n",
+               (unsigned long long) events, (unsigned long long) reads, round_count);
+        printf("%.3f us per event\n", elapsed * 1e6 / (double) events);
+    }
+    else
+        printf("No events were counted on this platform\n");
+
+    free(order);
+    free(windows);
+
+    glfwTerminate();
+    exit(EXIT_SUCCESS);
+}
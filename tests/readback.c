@@ -0,0 +1,121 @@
+//========================================================================
+// Framebuffer resize readback test
+// Copyright (c) Camilla Löwy <elmindreda@glfw.org>
+//
+// This software is provided 'as-is', without any express or implied
+// warranty. In no event will the authors be held liable for any damages
+// arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it
+// freely, subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented; you must not
+//    claim that you wrote the original software. If you use this software
+//    in a product, an acknowledgment in the product documentation would
+//    be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such, and must not
+//    be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source
+//    distribution.
+//
+//========================================================================
+//
+// This test resizes a window on the Null platform while its context is
+// current, makes the context current again, clears the framebuffer and reads
+// back the far corner pixel, which is only cleared if the default framebuffer
+// followed the resize
+//
+//========================================================================
+
+#define GLAD_GL_IMPLEMENTATION
+#include <glad/gl.h>
+#define GLFW_INCLUDE_NONE
+#include <GLFW/glfw3.h>
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "getopt.h"
+
+static void error_callback(int error, const char* description)
+{
+    fprintf(stderr, "Error: %s\n", description);
+}
+
+static void usage(void)
+{
+    printf("Usage: readback [-h] [-e|-o]\n");
+    printf("Options:\n");
+    printf("  -e use EGL\n");
+    printf("  -o use OSMesa\n");
+    printf("  -h show this help\n");
+}
+
+int main(int argc, char** argv)
+{
+    int ch, api = GLFW_EGL_CONTEXT_API;
+    GLFWwindow* window;
+    GLubyte pixel[4] = {0};
+
+    while ((ch = getopt(argc, argv, "eho")) != -1)
+    {
+        switch (ch)
+        {
+            case 'e':
+                api = GLFW_EGL_CONTEXT_API;
+                break;
+            case 'h':
+                usage();
+                exit(EXIT_SUCCESS);
+            case 'o':
+                api = GLFW_OSMESA_CONTEXT_API;
+                break;
+            default:
+                usage();
+                exit(EXIT_FAILURE);
+        }
+    }
+
+    glfwSetErrorCallback(error_callback);
+
+    glfwInitHint(GLFW_PLATFORM, GLFW_PLATFORM_NULL);
+
+    if (!glfwInit())
+        exit(EXIT_FAILURE);
+
+    glfwWindowHint(GLFW_CONTEXT_CREATION_API, api);
+
+    window = glfwCreateWindow(64, 64, "Readback Test", NULL, NULL);
+    if (!window)
+    {
+        glfwTerminate();
+        exit(EXIT_FAILURE);
+    }
+
+    glfwMakeContextCurrent(window);
+    gladLoadGL(glfwGetProcAddress);
+
+    glfwSetWindowSize(window, 100, 80);
+    glfwMakeContextCurrent(window);
+
+    glClearColor(1.f, 0.f, 0.f, 1.f);
+    glClear(GL_COLOR_BUFFER_BIT);
+    glReadPixels(99, 79, 1, 1, GL_RGBA, GL_UNSIGNED_BYTE, pixel);
+
+    glfwTerminate();
+
+    printf("Pixel at (99,79) is %u,%u,%u,%u\n",
+           pixel[0], pixel[1], pixel[2], pixel[3]);
+
+    if (pixel[0] != 255 || pixel[1] != 0 || pixel[2] != 0 || pixel[3] != 255)
+    {
+        fprintf(stderr, "Framebuffer was not resized\n");
+        exit(EXIT_FAILURE);
+    }
+
+    exit(EXIT_SUCCESS);
+}
+